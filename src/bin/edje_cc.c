@@ -358,6 +358,7 @@ main(int argc, char **argv)
    reorder_parts();
    data_process_scripts();
    data_process_lookups();
+   data_process_recalc_order();
    data_process_script_lookups();
    data_write();
 
@@ -191,6 +191,7 @@ int     object_handler_num(void);
 int     statement_handler_num(void);
 
 void    reorder_parts(void);
+void    data_process_recalc_order(void);
 void    source_edd(void);
 void    source_fetch(void);
 int     source_append(Eet_File *ef);
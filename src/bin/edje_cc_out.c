@@ -49,6 +49,7 @@ typedef struct _Group_Lookup Group_Lookup;
 typedef struct _Image_Lookup Image_Lookup;
 typedef struct _Slave_Lookup Slave_Lookup;
 typedef struct _Code_Lookup Code_Lookup;
+typedef struct _Recalc_Order_Walk Recalc_Order_Walk;
 
 
 struct _External_Lookup
@@ -111,6 +112,20 @@ struct _Code_Lookup
    Eina_Bool set;
 };
 
+struct _Recalc_Order_Walk
+{
+   Edje_Part_Collection *pc;
+   const char *state; /* NULL to walk all descriptions at once */
+   int flags; /* FLAG_X, FLAG_Y or both */
+
+   unsigned char *mark; /* 0 = not seen, 1 = walking, 2 = done */
+   Edje_Part_Order *order;
+   unsigned int count;
+
+   int cycle; /* part reached twice */
+   int from; /* part that closed the cycle */
+};
+
 typedef struct _Script_Lua_Writer Script_Lua_Writer;
 
 struct _Script_Lua_Writer
@@ -1724,6 +1739,209 @@ reorder_parts(void)
      }
 }
 
+static Eina_Bool _recalc_order_part_walk(Recalc_Order_Walk *w, int id);
+
+static Eina_Bool
+_recalc_order_dependency_walk(Recalc_Order_Walk *w, int id, int dep, Eina_Bool self)
+{
+   if ((dep < 0) || ((unsigned int) dep >= w->pc->parts_count)) return EINA_TRUE;
+   if ((dep == id) && !self) return EINA_TRUE;
+   return _recalc_order_part_walk(w, dep);
+}
+
+/* Mirror what _edje_part_recalc() recurses into for the given axes:
+ * relatives, confine, map center/light/perspective and proxy source. */
+static Eina_Bool
+_recalc_order_description_walk(Recalc_Order_Walk *w, Edje_Part *ep,
+                               Edje_Part_Description_Common *desc)
+{
+   if (!desc) return EINA_TRUE;
+
+#define RECALC_ORDER_WALK(Id, Self)                                     \
+   if (!_recalc_order_dependency_walk(w, ep->id, Id, Self)) return EINA_FALSE;
+
+   if (w->flags & FLAG_X)
+     {
+        RECALC_ORDER_WALK(desc->rel1.id_x, EINA_TRUE);
+        RECALC_ORDER_WALK(desc->rel2.id_x, EINA_TRUE);
+     }
+   if (w->flags & FLAG_Y)
+     {
+        RECALC_ORDER_WALK(desc->rel1.id_y, EINA_TRUE);
+        RECALC_ORDER_WALK(desc->rel2.id_y, EINA_TRUE);
+     }
+   if (desc->map.on)
+     {
+        RECALC_ORDER_WALK(desc->map.rot.id_center, EINA_FALSE);
+        RECALC_ORDER_WALK(desc->map.id_light, EINA_FALSE);
+        if (desc->map.persp_on)
+          RECALC_ORDER_WALK(desc->map.id_persp, EINA_FALSE);
+     }
+   if (ep->type == EDJE_PART_TYPE_PROXY)
+     RECALC_ORDER_WALK(((Edje_Part_Description_Proxy *) desc)->proxy.id, EINA_FALSE);
+
+#undef RECALC_ORDER_WALK
+
+   return EINA_TRUE;
+}
+
+static Eina_Bool
+_recalc_order_part_walk(Recalc_Order_Walk *w, int id)
+{
+   Edje_Part *ep;
+   Eina_Bool found = EINA_FALSE;
+   unsigned int i;
+
+   if (w->mark[id] == 2) return EINA_TRUE;
+   if (w->mark[id] == 1)
+     {
+        w->cycle = id;
+        return EINA_FALSE;
+     }
+   w->mark[id] = 1;
+
+   ep = w->pc->parts[id];
+
+   if (!_recalc_order_dependency_walk(w, id, ep->dragable.confine_id, EINA_TRUE))
+     goto on_cycle;
+
+   for (i = 0; i < ep->other.desc_count; ++i)
+     {
+        Edje_Part_Description_Common *desc = ep->other.desc[i];
+
+        if (w->state && (!desc->state.name || strcmp(desc->state.name, w->state)))
+          continue;
+        if (!_recalc_order_description_walk(w, ep, desc))
+          goto on_cycle;
+        found = EINA_TRUE;
+     }
+
+   /* a part without the requested state stays in its default one */
+   if ((!w->state) || (!found) ||
+       (ep->default_desc && ep->default_desc->state.name &&
+        !strcmp(ep->default_desc->state.name, w->state)))
+     if (!_recalc_order_description_walk(w, ep, ep->default_desc))
+       goto on_cycle;
+
+   w->mark[id] = 2;
+   if (w->order) w->order[w->count++].part = id;
+   return EINA_TRUE;
+
+ on_cycle:
+   if (w->from < 0) w->from = id;
+   return EINA_FALSE;
+}
+
+static Eina_Bool
+_recalc_order_walk(Recalc_Order_Walk *w, const char *state, int flags)
+{
+   unsigned int i;
+
+   memset(w->mark, 0, w->pc->parts_count);
+   w->state = state;
+   w->flags = flags;
+   w->count = 0;
+   w->cycle = -1;
+   w->from = -1;
+
+   for (i = 0; i < w->pc->parts_count; ++i)
+     if (!_recalc_order_part_walk(w, i))
+       return EINA_FALSE;
+
+   return EINA_TRUE;
+}
+
+static void
+_recalc_order_state_check(Recalc_Order_Walk *w, const char *state)
+{
+   static const int axis[] = { FLAG_X, FLAG_Y };
+   unsigned int i;
+
+   w->order = NULL;
+   for (i = 0; i < sizeof (axis) / sizeof (axis[0]); ++i)
+     {
+        if (_recalc_order_walk(w, state, axis[i]))
+          continue;
+
+        /* every part starts in its default state, so a loop there can
+           not be avoided at runtime */
+        if (!strcmp(state, "default"))
+          {
+             ERR("Circular dependency between part \"%s\" and part \"%s\" on the %s axis in group \"%s\".",
+                 w->pc->parts[w->from]->name, w->pc->parts[w->cycle]->name,
+                 axis[i] == FLAG_X ? "x" : "y", w->pc->part);
+             exit(-1);
+          }
+        WRN("Circular dependency between part \"%s\" and part \"%s\" on the %s axis when all parts are in state \"%s\" in group \"%s\".",
+            w->pc->parts[w->from]->name, w->pc->parts[w->cycle]->name,
+            axis[i] == FLAG_X ? "x" : "y", state, w->pc->part);
+     }
+}
+
+/* Sort the parts of every group so that each one comes after all the parts
+ * it could depend on in any of its descriptions. The runtime then walks this
+ * array instead of discovering the order by recursion. The x and y axis are
+ * calculated independently by edje, so a loop that spans both of them is
+ * legal: those groups get no precomputed order and keep the runtime walk.
+ * Part ids must be resolved, so this is done after data_process_lookups(). */
+void
+data_process_recalc_order(void)
+{
+   Edje_Part_Collection *pc;
+   Eina_List *l;
+
+   EINA_LIST_FOREACH(edje_collections, l, pc)
+     {
+        Recalc_Order_Walk w;
+        Eina_List *states = NULL;
+        const char *state;
+        unsigned int i, j;
+
+        if (!pc->parts_count) continue;
+
+        memset(&w, 0, sizeof (w));
+        w.pc = pc;
+        w.mark = mem_alloc(pc->parts_count);
+
+        states = eina_list_append(states, "default");
+        for (i = 0; i < pc->parts_count; ++i)
+          for (j = 0; j < pc->parts[i]->other.desc_count; ++j)
+            {
+               Eina_List *l2;
+               const char *name;
+               Eina_Bool known = EINA_FALSE;
+
+               name = pc->parts[i]->other.desc[j]->state.name;
+               if (!name) continue;
+               EINA_LIST_FOREACH(states, l2, state)
+                 if (!strcmp(state, name))
+                   {
+                      known = EINA_TRUE;
+                      break;
+                   }
+               if (!known) states = eina_list_append(states, name);
+            }
+
+        EINA_LIST_FREE(states, state)
+          _recalc_order_state_check(&w, state);
+
+        w.order = mem_alloc(SZ(Edje_Part_Order) * pc->parts_count);
+        if (_recalc_order_walk(&w, NULL, FLAG_XY))
+          {
+             pc->recalc_order.parts = w.order;
+             pc->recalc_order.parts_count = w.count;
+          }
+        else
+          {
+             INF("No static recalc order for group \"%s\", part \"%s\" and part \"%s\" depend on each other on different axis.",
+                 pc->part, pc->parts[w.from]->name, pc->parts[w.cycle]->name);
+             free(w.order);
+          }
+
+        free(w.mark);
+     }
+}
+
 void
 data_queue_group_lookup(const char *name, Edje_Part *part)
 {
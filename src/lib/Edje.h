@@ -561,6 +561,14 @@ struct _Edje_Message_String_Float_Set
    double val[1]; /**< The message's @b array of floats */
 }; /**< Structure passed as value on #EDJE_MESSAGE_STRING_FLOAT_SET messages. The array and string in it are automatically freed be Edje if passed to you by Edje */
 
+typedef struct _Edje_Signal_Emission Edje_Signal_Emission;
+
+struct _Edje_Signal_Emission
+{
+   const char *emission; /**< The signal's "emission" string */
+   const char *source; /**< The signal's "source" string */
+}; /**< A signal to emit with edje_object_signal_batch_emit() @since 1.7 */
+
 typedef enum _Edje_Drag_Dir
 {
    EDJE_DRAG_DIR_NONE = 0,
@@ -598,6 +606,13 @@ typedef enum _Edje_Text_Autocapital_Type
    EDJE_TEXT_AUTOCAPITAL_TYPE_ALLCHARACTER
 } Edje_Text_Autocapital_Type;
 
+typedef enum _Edje_Animation_Lod
+{
+   EDJE_ANIMATION_LOD_DEFAULT = 0, /**< Follow edje_animation_lod_set() */
+   EDJE_ANIMATION_LOD_OFF = 1, /**< Animate every frame */
+   EDJE_ANIMATION_LOD_ON = 2 /**< Skip frames while hidden, off the canvas or small */
+} Edje_Animation_Lod;
+
 /**
  * The possible types the parameters of an EXTERNAL part can be.
  */
@@ -901,6 +916,7 @@ typedef void         (*Edje_Message_Handler_Cb) (void *data, Evas_Object *obj, E
 typedef void         (*Edje_Text_Filter_Cb)     (void *data, Evas_Object *obj, const char *part, Edje_Text_Filter_Type type, char **text);
 typedef void         (*Edje_Markup_Filter_Cb)   (void *data, Evas_Object *obj, const char *part, char **text);
 typedef Evas_Object *(*Edje_Item_Provider_Cb)   (void *data, Evas_Object *obj, const char *part, const char *item);
+typedef void         (*Edje_File_Preload_Cb)    (void *data, const char *file, const char *group, Eina_Bool success); /**< Callback of edje_file_collection_preload(). @c success tells whether @c group of @c file could be loaded. @since 1.7 */
 
 /**
  * @brief Initialize the Edje library.
@@ -972,6 +988,52 @@ EAPI void         edje_frametime_set              (double t);
  */
 EAPI double       edje_frametime_get              (void);
 
+/**
+ * @brief Set the time spent per idle pass on asynchronous loads.
+ *
+ * @param t The time, in seconds. Default is 0.004.
+ *
+ * The idler setting up objects queued by edje_object_file_set_async()
+ * starts no new object once @p t is spent in the pass. An object is
+ * always set up as a whole, so one is done in each pass at least.
+ *
+ * @see edje_object_file_set_async()
+ * @since 1.7
+ */
+EAPI void         edje_file_async_budget_set      (double t);
+
+/**
+ * @brief Get the time spent per idle pass on asynchronous loads.
+ *
+ * @return The time set by edje_file_async_budget_set(), in seconds.
+ *
+ * @see edje_file_async_budget_set()
+ * @since 1.7
+ */
+EAPI double       edje_file_async_budget_get      (void);
+
+/**
+ * @brief Set whether visible objects are loaded first.
+ *
+ * @param visible_first @c EINA_TRUE to set up the visible objects queued
+ * by edje_object_file_set_async() before the hidden ones. Default is
+ * @c EINA_FALSE, objects are set up in the order they were queued.
+ *
+ * @see edje_object_file_set_async()
+ * @since 1.7
+ */
+EAPI void         edje_file_async_visible_first_set (Eina_Bool visible_first);
+
+/**
+ * @brief Get whether visible objects are loaded first.
+ *
+ * @return The value set by edje_file_async_visible_first_set().
+ *
+ * @see edje_file_async_visible_first_set()
+ * @since 1.7
+ */
+EAPI Eina_Bool    edje_file_async_visible_first_get (void);
+
 /**
  * @brief Freeze Edje objects.
  *
@@ -1169,6 +1231,34 @@ EAPI void         edje_file_collection_list_free  (Eina_List *lst);
  */
 EAPI Eina_Bool    edje_file_group_exists          (const char *file, const char *glob);
 
+/**
+ * @brief Load a group of an edje file in the background.
+ *
+ * @param file The path to the .edj file
+ * @param group The group to load
+ * @param func The function called when the group is loaded, or @c NULL
+ * @param data The data passed to @p func
+ * @return @c EINA_TRUE if the load started, @c EINA_FALSE if @p file
+ * could not be opened or has no such @p group.
+ *
+ * The group is decoded and its signal matching prepared in a thread,
+ * then it is put in the collection cache from the main loop, where
+ * @p func is called. A later edje_object_file_set() on that group then
+ * only has to create the objects. An edje_object_file_set() done before
+ * the load finished waits for it instead of loading the group again.
+ *
+ * The preloaded group stays in the collection cache only as long as the
+ * limits of edje_collection_cache_set() allow, the file is opened on the
+ * calling thread.
+ *
+ * A load still running when edje_shutdown() is called is reported to
+ * @p func as failed from there.
+ *
+ * @see edje_collection_cache_set()
+ * @since 1.7
+ */
+EAPI Eina_Bool    edje_file_collection_preload    (const char *file, const char *group, Edje_File_Preload_Cb func, const void *data);
+
 /**
  * Get data from the file level data block of an edje file
  * @param file The path to the .edj file
@@ -1229,6 +1319,76 @@ EAPI int          edje_file_cache_get             (void);
  */
 EAPI void         edje_file_cache_flush           (void);
 
+/**
+ * @brief Set the memory limit of the file cache.
+ *
+ * @param bytes The most memory, in bytes, the unused files kept in the
+ * cache may account for. Default is 0, no limit besides the count set
+ * by edje_file_cache_set().
+ *
+ * A file accounts for its size on disk and for the collections it
+ * keeps cached. The least recently used files are dropped first.
+ *
+ * @see edje_file_cache_bytes_get()
+ * @see edje_file_cache_set()
+ * @since 1.7
+ */
+EAPI void         edje_file_cache_bytes_set       (size_t bytes);
+
+/**
+ * @brief Return the memory limit of the file cache.
+ *
+ * @return The limit set by edje_file_cache_bytes_set(), in bytes.
+ *
+ * @see edje_file_cache_bytes_set()
+ * @since 1.7
+ */
+EAPI size_t       edje_file_cache_bytes_get       (void);
+
+/**
+ * @brief Set how often cached edje files are checked against the disk.
+ *
+ * @param interval The time in seconds a cached file is trusted after it
+ * was last checked. Default is 0.0, the file is checked with stat() every
+ * time it is used. A negative value never checks it again, until a change
+ * is reported.
+ *
+ * Setting up many objects from the same file costs a stat() each. A
+ * cached file is always checked again on its next use after it was
+ * reported changed, either by the file monitor when edje is built with
+ * Eio or by edje_file_cache_invalidate().
+ *
+ * @see edje_file_cache_revalidate_get()
+ * @see edje_file_cache_invalidate()
+ * @since 1.7
+ */
+EAPI void         edje_file_cache_revalidate_set  (double interval);
+
+/**
+ * @brief Return how often cached edje files are checked against the disk.
+ *
+ * @return The interval set by edje_file_cache_revalidate_set().
+ *
+ * @see edje_file_cache_revalidate_set()
+ * @since 1.7
+ */
+EAPI double       edje_file_cache_revalidate_get  (void);
+
+/**
+ * @brief Report that an edje file changed on disk.
+ *
+ * @param file The path of the file, as given to edje_object_file_set(),
+ * or @c NULL for every cached file.
+ *
+ * The cached copy of @p file is checked against the disk the next time
+ * it is used, whatever the interval set by
+ * edje_file_cache_revalidate_set().
+ *
+ * @see edje_file_cache_revalidate_set()
+ * @since 1.7
+ */
+EAPI void         edje_file_cache_invalidate      (const char *file);
+
 /**
  * @brief Set the collection cache size.
  *
@@ -1259,6 +1419,32 @@ EAPI void         edje_collection_cache_set       (int count);
  */
 EAPI int          edje_collection_cache_get       (void);
 
+/**
+ * @brief Set the memory limit of the collection cache.
+ *
+ * @param bytes The most memory, in bytes, the unused collections of a
+ * file may account for. Default is 0, no limit besides the count set by
+ * edje_collection_cache_set().
+ *
+ * The size of a collection is estimated from its parts, descriptions
+ * and programs. The least recently used collections are dropped first.
+ *
+ * @see edje_collection_cache_bytes_get()
+ * @see edje_collection_cache_set()
+ * @since 1.7
+ */
+EAPI void         edje_collection_cache_bytes_set (size_t bytes);
+
+/**
+ * @brief Return the memory limit of the collection cache.
+ *
+ * @return The limit set by edje_collection_cache_bytes_set(), in bytes.
+ *
+ * @see edje_collection_cache_bytes_set()
+ * @since 1.7
+ */
+EAPI size_t       edje_collection_cache_bytes_get (void);
+
 /**
  * @brief Clean the collection cache.
  *
@@ -1271,6 +1457,46 @@ EAPI int          edje_collection_cache_get       (void);
  */
 EAPI void         edje_collection_cache_flush     (void);
 
+/**
+ * @brief Set the program cache size.
+ *
+ * @param count The number of signal/source pairs remembered per group.
+ * Default is 32, 0 disables the cache.
+ *
+ * When a signal is emitted, edje remembers which programs of the group
+ * it matched, so that emitting it again skips the matching. The least
+ * recently emitted pairs are dropped past @p count, from the groups
+ * already loaded as well.
+ *
+ * @see edje_program_cache_get()
+ * @see edje_program_cache_stats_get()
+ * @since 1.7
+ */
+EAPI void         edje_program_cache_set          (int count);
+
+/**
+ * @brief Return the program cache size.
+ *
+ * @return The number of signal/source pairs remembered per group.
+ *
+ * @see edje_program_cache_set()
+ * @since 1.7
+ */
+EAPI int          edje_program_cache_get          (void);
+
+/**
+ * @brief Get the program cache statistics.
+ *
+ * @param hits Where to store the number of emissions served by the cache.
+ * @param misses Where to store the number of emissions that needed a match.
+ *
+ * Any of the pointers may be @c NULL.
+ *
+ * @see edje_program_cache_set()
+ * @since 1.7
+ */
+EAPI void         edje_program_cache_stats_get    (unsigned int *hits, unsigned int *misses);
+
 /**
  * @brief Set Edje color class.
  *
@@ -1601,6 +1827,37 @@ EAPI const char  *edje_object_data_get            (const Evas_Object *obj, const
  */
 EAPI Eina_Bool        edje_object_file_set        (Evas_Object *obj, const char *file, const char *group);
 
+/**
+ * @brief Sets the @b EDJ file and group of an Edje object without
+ * blocking the main loop
+ *
+ * @param obj A handle to an Edje object
+ * @param file The path to the EDJ file to load @p from
+ * @param group The name of the group, in @p file, which implements an
+ * Edje object
+ * @return @c EINA_TRUE if the load was queued, @c EINA_FALSE if @p obj
+ * is not an Edje object
+ *
+ * The group and every group it nests through GROUP, BOX or TABLE parts
+ * are first loaded in the background with
+ * edje_file_collection_preload(). Then edje_object_file_set() is called
+ * from an idler, which sets up as many queued objects per pass as fit
+ * in the budget set by edje_file_async_budget_set(). The preloaded
+ * groups are held until then, whatever the limits of
+ * edje_collection_cache_set().
+ *
+ * When done, the smart callback @c "load,done" is called on @p obj, or
+ * @c "load,error" if edje_object_file_set() failed, in which case
+ * edje_object_load_error_get() tells why. Calling edje_object_file_set()
+ * or this function again on @p obj before that drops the pending load.
+ *
+ * @see edje_object_file_set()
+ * @see edje_file_async_budget_set()
+ * @see edje_file_async_visible_first_set()
+ * @since 1.7
+ */
+EAPI Eina_Bool        edje_object_file_set_async  (Evas_Object *obj, const char *file, const char *group);
+
 /**
  * @brief Get the file and group name that a given Edje object is bound to
  *
@@ -1822,6 +2079,38 @@ EAPI void        *edje_object_signal_callback_del_full(Evas_Object *obj, const c
  */
 EAPI void         edje_object_signal_emit         (Evas_Object *obj, const char *emission, const char *source);
 
+/**
+ * @brief Send several signals to an edje object at once.
+ *
+ * @param obj A handle to an Edje object
+ * @param signals The signals, in the order they are to be handled
+ * @param count The number of signals
+ *
+ * This is the same as calling edje_object_signal_emit() for each of
+ * the @p signals, but they travel through the message queue, and to
+ * the object's sub objects, as a single message.
+ *
+ * @see edje_object_signal_emit()
+ * @since 1.7
+ */
+EAPI void         edje_object_signal_batch_emit   (Evas_Object *obj, const Edje_Signal_Emission *signals, unsigned int count);
+
+/**
+ * @brief Send a signal to several edje objects.
+ *
+ * @param objs The Edje objects
+ * @param count The number of objects
+ * @param emission The signal's "emission" string
+ * @param source The signal's "source" string
+ *
+ * This is the same as calling edje_object_signal_emit() on each of
+ * the @p objs, without looking the strings up again for every object.
+ *
+ * @see edje_object_signal_emit()
+ * @since 1.7
+ */
+EAPI void         edje_objects_signal_emit        (Evas_Object * const *objs, unsigned int count, const char *emission, const char *source);
+
 /**
  * @brief Get extra data passed to callbacks.
  *
@@ -1898,6 +2187,82 @@ EAPI void         edje_object_animation_set       (Evas_Object *obj, Eina_Bool o
  */
 EAPI Eina_Bool    edje_object_animation_get       (const Evas_Object *obj);
 
+/**
+ * @brief Set the animation level of detail policy of an Edje object.
+ *
+ * @param obj A handle to an Edje object.
+ * @param lod The policy, #EDJE_ANIMATION_LOD_DEFAULT to follow the global
+ * one set by edje_animation_lod_set().
+ *
+ * When the policy is on, the running programs of an object that is
+ * hidden, clipped out or outside of the canvas viewport are not advanced.
+ * Their clocks keep going, so once the object shows up again they jump
+ * to where they should be, or to their final state and what runs after
+ * them. Objects no bigger than the size given to
+ * edje_animation_lod_small_set() are only animated every few frames.
+ *
+ * @see edje_object_animation_lod_get()
+ * @since 1.7
+ */
+EAPI void         edje_object_animation_lod_set   (Evas_Object *obj, Edje_Animation_Lod lod);
+
+/**
+ * @brief Get the animation level of detail policy of an Edje object.
+ *
+ * @param obj A handle to an Edje object.
+ * @return The policy set by edje_object_animation_lod_set().
+ *
+ * @see edje_object_animation_lod_set()
+ * @since 1.7
+ */
+EAPI Edje_Animation_Lod edje_object_animation_lod_get (const Evas_Object *obj);
+
+/**
+ * @brief Set the global animation level of detail policy.
+ *
+ * @param on @c EINA_TRUE to skip frames of hidden, off canvas and small
+ * objects by default. Default is @c EINA_FALSE.
+ *
+ * @see edje_object_animation_lod_set()
+ * @see edje_animation_lod_get()
+ * @since 1.7
+ */
+EAPI void         edje_animation_lod_set          (Eina_Bool on);
+
+/**
+ * @brief Get the global animation level of detail policy.
+ *
+ * @return The policy set by edje_animation_lod_set().
+ *
+ * @see edje_animation_lod_set()
+ * @since 1.7
+ */
+EAPI Eina_Bool    edje_animation_lod_get          (void);
+
+/**
+ * @brief Set how small objects are animated under the level of detail policy.
+ *
+ * @param size Objects whose width and height are both at most @p size are
+ * small. Default is 32.
+ * @param divisor Small objects are animated once every @p divisor frames,
+ * 1 or less animates them every frame. Default is 4.
+ *
+ * @see edje_animation_lod_small_get()
+ * @since 1.7
+ */
+EAPI void         edje_animation_lod_small_set    (Evas_Coord size, unsigned int divisor);
+
+/**
+ * @brief Get how small objects are animated under the level of detail policy.
+ *
+ * @param size Where to store the size, may be @c NULL.
+ * @param divisor Where to store the divisor, may be @c NULL.
+ *
+ * @see edje_animation_lod_small_set()
+ * @since 1.7
+ */
+EAPI void         edje_animation_lod_small_get    (Evas_Coord *size, unsigned int *divisor);
+
 /**
  * @brief Freezes the Edje object.
  *
@@ -2085,6 +2450,48 @@ EAPI void edje_object_update_hints_set(Evas_Object *obj, Eina_Bool update);
  */
 EAPI Eina_Bool edje_object_update_hints_get(Evas_Object *obj);
 
+/**
+ * @brief Keep the calculated geometry of each part state between recalc.
+ *
+ * @param obj A handle to an Edje object.
+ * @param cache Whether or not to cache part calculations.
+ *
+ * With the cache on, a part state whose inputs did not change since the
+ * previous recalc is not calculated again, which helps objects that are
+ * moved around a lot but rarely resized. It costs memory for every part
+ * state that gets reused, so it is best left off for objects that are
+ * created in large numbers. The default comes from the
+ * --enable-edje-calc-cache configure switch. Turning it off releases
+ * that memory.
+ *
+ * @see edje_object_calc_cache_stats_get()
+ * @since 1.7
+ */
+EAPI void edje_object_calc_cache_set(Evas_Object *obj, Eina_Bool cache);
+
+/**
+ * @brief Whether or not part calculations are cached for this object.
+ *
+ * @param obj A handle to an Edje object.
+ * @return @c EINA_TRUE if they are, @c EINA_FALSE otherwise.
+ * @since 1.7
+ */
+EAPI Eina_Bool edje_object_calc_cache_get(const Evas_Object *obj);
+
+/**
+ * @brief Get the calculation cache counters of an Edje object.
+ *
+ * @param obj A handle to an Edje object.
+ * @param hits Where to store how many part states were reused.
+ * @param misses Where to store how many part states were calculated.
+ * @param bytes Where to store the memory currently used by the cache.
+ *
+ * The counters only move while the cache is on, see
+ * edje_object_calc_cache_set().
+ * @since 1.7
+ */
+EAPI void edje_object_calc_cache_stats_get(const Evas_Object *obj, unsigned int *hits, unsigned int *misses, unsigned int *bytes);
+
 /**
  * @brief Get the maximum size specified -- as an EDC property -- for a
  * given Edje object
@@ -3823,6 +4230,23 @@ EAPI void         edje_object_message_signal_process      (Evas_Object *obj);
  */
 EAPI void         edje_message_signal_process             (void);
 
+/**
+ * @brief Get the batching statistics of the edje message queue.
+ *
+ * @param flushes Where to store the number of global queue flushes.
+ * @param messages Where to store the number of messages processed.
+ * @param latency Where to store the average time, in seconds, between
+ * the first message queued and its flush.
+ * @param latency_max Where to store the longest of these times.
+ *
+ * Messages are not processed when sent but batched until the main loop
+ * flushes the queue. @p messages divided by @p flushes gives the
+ * average batch size. Any of the pointers may be @c NULL.
+ *
+ * @since 1.7
+ */
+EAPI void         edje_message_signal_stats_get           (unsigned int *flushes, unsigned int *messages, double *latency, double *latency_max);
+
 /**
  * Register a type to be used by EXTERNAL parts.
  *
@@ -3,41 +3,66 @@
 
 static Eina_Hash   *_edje_file_hash = NULL;
 static int          _edje_file_cache_size = 16;
-static Eina_List   *_edje_file_cache = NULL;
+static size_t       _edje_file_cache_bytes_max = 0;
+/* unreferenced files, most recently used first, and indexed by path */
+static Eina_Inlist *_edje_file_cache = NULL;
+static Eina_Hash   *_edje_file_cache_hash = NULL;
+static unsigned int _edje_file_cache_count = 0;
+static size_t       _edje_file_cache_bytes = 0;
 
 static int          _edje_collection_cache_size = 16;
+static size_t       _edje_collection_cache_bytes_max = 0;
 
-static Edje_Part_Collection *
-_edje_file_coll_open(Edje_File *edf, const char *coll)
+static double       _edje_file_cache_revalidate = 0.0;
+
+/* a group being decoded by edje_file_collection_preload(), the thread
+ * only fills edc, everything else belongs to the main loop */
+struct _Edje_Collection_Preload
 {
-   Edje_Part_Collection *edc = NULL;
+   Edje_File                            *edf;
    Edje_Part_Collection_Directory_Entry *ce;
-   int id = -1, size = 0;
-   Eina_List *l;
-   char buf[256];
-   char *buffer;
-   void *data;
-
-   ce = eina_hash_find(edf->collection, coll);
-   if (!ce) return NULL;
+   Edje_Part_Collection                 *edc;
+   const char                           *file;
+   const char                           *group;
+   Edje_File_Preload_Cb                  func;
+   const void                           *data;
+   Eina_Bool                             taken : 1; /* no decoding left to do */
+   Eina_Bool                             shutdown : 1;
+};
+
+static Eina_List   *_edje_collection_preloads = NULL;
+/* the decoders allocate from pools set in globals, so only one collection
+ * is decoded at a time once a preload thread may be running */
+static Eina_Lock    _edje_collection_decode_lock;
+static Eina_Bool    _edje_collection_decode_lock_ready = EINA_FALSE;
+
+static void _edje_file_cache_del(Edje_File *edf);
+
+/* Entries stored without compression are returned straight from the
+ * mapped file, compressed ones are inflated into a private copy that
+ * *copy must free. */
+const void *
+_edje_file_data_get(Edje_File *edf, const char *key, int *size, void **copy)
+{
+   const void *data;
 
-   if (ce->ref)
-     {
-	ce->ref->references++;
-	return ce->ref;
-     }
+   *copy = NULL;
+   data = eet_read_direct(edf->ef, key, size);
+   if (data) return data;
 
-   EINA_LIST_FOREACH(edf->collection_cache, l, edc)
-     {
-	if (!strcmp(edc->part, coll))
-	  {
-	     edc->references = 1;
-	     ce->ref = edc;
+   *copy = eet_read(edf->ef, key, size);
+   return *copy;
+}
 
-	     edf->collection_cache = eina_list_remove_list(edf->collection_cache, l);
-	     return ce->ref;
-	  }
-     }
+/* everything that only reads the file, so it can be done by a preload
+ * thread */
+static Edje_Part_Collection *
+_edje_file_coll_decode(Edje_File *edf, Edje_Part_Collection_Directory_Entry *ce)
+{
+   Edje_Part_Collection *edc;
+   int id;
+   char buf[256];
+   char *buffer;
 
    id = ce->id;
    if (id < 0) return NULL;
@@ -104,25 +129,89 @@ _edje_file_coll_open(Edje_File *edf, const char *coll)
           }
      }
 
+   return edc;
+}
+
+static Edje_Part_Collection *
+_edje_collection_preload_take(Edje_Collection_Preload *pl)
+{
+   Edje_Part_Collection *edc;
+
+   eina_lock_take(&_edje_collection_decode_lock);
+   pl->taken = EINA_TRUE;
+   edc = pl->edc;
+   pl->edc = NULL;
+   eina_lock_release(&_edje_collection_decode_lock);
+
+   if (pl->ce->preload == pl) pl->ce->preload = NULL;
+   return edc;
+}
+
+static Edje_Part_Collection *
+_edje_file_coll_open(Edje_File *edf, const char *coll)
+{
+   Edje_Part_Collection *edc = NULL;
+   Edje_Part_Collection_Directory_Entry *ce;
+   int id, size = 0;
+   char buf[256];
+   const void *data;
+   void *copy;
+
+   ce = eina_hash_find(edf->collection, coll);
+   if (!ce) return NULL;
+
+   if (ce->ref)
+     {
+	ce->ref->references++;
+	return ce->ref;
+     }
+
+   if (ce->cached)
+     {
+	edc = ce->cached;
+	_edje_cache_coll_remove(edf, edc);
+	edc->references = 1;
+	ce->ref = edc;
+	return ce->ref;
+     }
+
+   if (ce->preload)
+     edc = _edje_collection_preload_take(ce->preload);
+
+   if (!edc)
+     {
+	if (_edje_collection_preloads)
+	  eina_lock_take(&_edje_collection_decode_lock);
+	edc = _edje_file_coll_decode(edf, ce);
+	if (_edje_collection_preloads)
+	  eina_lock_release(&_edje_collection_decode_lock);
+	if (!edc) return NULL;
+     }
+   id = ce->id;
+
    snprintf(buf, sizeof(buf), "edje/scripts/embryo/compiled/%i", id);
-   data = eet_read(edf->ef, buf, &size);
+   data = _edje_file_data_get(edf, buf, &size, &copy);
 
    if (data)
      {
-	edc->script = embryo_program_new(data, size);
+	/* embryo relocates and runs its program in place, so it keeps a
+	 * private copy anyway, made here straight from the file */
+	edc->script = embryo_program_new((void *) data, size);
 	_edje_embryo_script_init(edc);
-	free(data);
+	free(copy);
      }
 
    snprintf(buf, sizeof(buf), "edje/scripts/lua/%i", id);
-   data = eet_read(edf->ef, buf, &size);
+   data = _edje_file_data_get(edf, buf, &size, &copy);
 
    if (data)
      {
         _edje_lua2_script_load(edc, data, size);
-	free(data);
+	free(copy);
      }
 
+   _edje_collection_part_names_build(edc);
+
    ce->ref = edc;
 
    return edc;
@@ -163,6 +252,7 @@ _edje_file_change(void *data, int ev_type __UNUSED__, void *event)
 
    if (ev->monitor == edf->monitor)
      {
+        edf->changed = EINA_TRUE;
         if (edf->timeout) ecore_timer_del(edf->timeout);
         edf->timeout = ecore_timer_add(0.5, _edje_file_warn, edf);
      }
@@ -171,7 +261,7 @@ _edje_file_change(void *data, int ev_type __UNUSED__, void *event)
 #endif
 
 static Edje_File *
-_edje_file_open(const char *file, const char *coll, int *error_ret, Edje_Part_Collection **edc_ret, time_t mtime)
+_edje_file_open(const char *file, const char *coll, int *error_ret, Edje_Part_Collection **edc_ret, const struct stat *st)
 {
    Edje_File *edf;
    Edje_Part_Collection *edc;
@@ -195,7 +285,9 @@ _edje_file_open(const char *file, const char *coll, int *error_ret, Edje_Part_Co
      }
 
    edf->ef = ef;
-   edf->mtime = mtime;
+   edf->mtime = st->st_mtime;
+   edf->size = st->st_size;
+   edf->checked_at = ecore_loop_time_get();
 #ifdef HAVE_EIO
    edf->monitor = eio_monitor_add(file);
    ev = ecore_event_handler_add(EIO_MONITOR_FILE_DELETED, _edje_file_change, edf);
@@ -259,18 +351,38 @@ _edje_file_dangling(Edje_File *edf)
      }
 }
 
+/* 1 if edf can be used as is, 0 if its file changed on disk and -1 if
+ * the file is gone, only calling stat() when the revalidation policy
+ * does not trust the cached copy */
+int
+_edje_cache_file_check(Edje_File *edf)
+{
+   struct stat st;
+   double now;
+
+   now = ecore_loop_time_get();
+   if ((!edf->changed) && (_edje_file_cache_revalidate != 0.0))
+     {
+	if (_edje_file_cache_revalidate < 0.0) return 1;
+	if (now - edf->checked_at < _edje_file_cache_revalidate) return 1;
+     }
+
+   if (stat(edf->path, &st) != 0) return -1;
+   if (st.st_mtime != edf->mtime) return 0;
+   edf->changed = EINA_FALSE;
+   edf->checked_at = now;
+   return 1;
+}
+
 Edje_File *
 _edje_cache_file_coll_open(const char *file, const char *coll, int *error_ret, Edje_Part_Collection **edc_ret, Edje *ed)
 {
    Edje_File *edf;
-   Eina_List *l, *hist;
+   Eina_List *hist;
    Edje_Part_Collection *edc;
    Edje_Part *ep;
    struct stat st;
 
-   if (stat(file, &st) != 0)
-      return NULL;
-
    if (!_edje_file_hash)
      {
 	_edje_file_hash = eina_hash_string_small_new(NULL);
@@ -280,39 +392,46 @@ _edje_cache_file_coll_open(const char *file, const char *coll, int *error_ret, E
    edf = eina_hash_find(_edje_file_hash, file);
    if (edf)
      {
-	if (edf->mtime != st.st_mtime)
+	switch (_edje_cache_file_check(edf))
 	  {
-	     _edje_file_dangling(edf);
-	     goto open_new;
+	   case -1:
+	      return NULL;
+	   case 0:
+	      _edje_file_dangling(edf);
+	      goto open_new;
 	  }
 
 	edf->references++;
 	goto open;
      }
 
-   EINA_LIST_FOREACH(_edje_file_cache, l, edf)
+   edf = _edje_file_cache_hash ? eina_hash_find(_edje_file_cache_hash, file) : NULL;
+   if (edf)
      {
-	if (!strcmp(edf->path, file))
+	switch (_edje_cache_file_check(edf))
 	  {
-	     if (edf->mtime != st.st_mtime)
-	       {
-		  _edje_file_cache = eina_list_remove_list(_edje_file_cache, l);
-		  _edje_file_free(edf);
-		  goto open_new;
-	       }
-
-	     edf->references = 1;
-	     _edje_file_cache = eina_list_remove_list(_edje_file_cache, l);
-	     eina_hash_add(_edje_file_hash, file, edf);
-	     goto open;
+	   case -1:
+	      return NULL;
+	   case 0:
+	      _edje_file_cache_del(edf);
+	      _edje_file_free(edf);
+	      goto open_new;
 	  }
+
+	edf->references = 1;
+	_edje_file_cache_del(edf);
+	eina_hash_add(_edje_file_hash, file, edf);
+	goto open;
      }
 
 open_new:
+   if (stat(file, &st) != 0)
+      return NULL;
+
    if (!_edje_file_hash)
       _edje_file_hash = eina_hash_string_small_new(NULL);
 
-   edf = _edje_file_open(file, coll, error_ret, edc_ret, st.st_mtime);
+   edf = _edje_file_open(file, coll, error_ret, edc_ret, &st);
    if (!edf)
       return NULL;
 
@@ -438,40 +557,97 @@ open:
    return edf;
 }
 
+/* a rough count of the memory held by a loaded collection, its parts,
+ * descriptions and programs */
+static size_t
+_edje_collection_bytes(Edje_Part_Collection_Directory_Entry *ce, Edje_Part_Collection *edc)
+{
+   size_t bytes;
+
+   bytes = sizeof (Edje_Part_Collection)
+     + edc->parts_count * (sizeof (Edje_Part) + sizeof (Edje_Part *))
+     + (edc->programs.fnmatch_count + edc->programs.strcmp_count
+        + edc->programs.strncmp_count + edc->programs.strrncmp_count
+        + edc->programs.nocmp_count) * sizeof (Edje_Program);
+   if (!ce) return bytes;
+
+   bytes += (ce->count.RECTANGLE + ce->count.SWALLOW + ce->count.GROUP
+             + ce->count.SPACER) * sizeof (Edje_Part_Description_Common)
+     + (ce->count.TEXT + ce->count.TEXTBLOCK) * sizeof (Edje_Part_Description_Text)
+     + ce->count.IMAGE * sizeof (Edje_Part_Description_Image)
+     + ce->count.PROXY * sizeof (Edje_Part_Description_Proxy)
+     + ce->count.BOX * sizeof (Edje_Part_Description_Box)
+     + ce->count.TABLE * sizeof (Edje_Part_Description_Table)
+     + ce->count.EXTERNAL * sizeof (Edje_Part_Description_External);
+   return bytes;
+}
+
+/* keep the file cache total in step with the collections a cached file
+ * still holds */
+static void
+_edje_file_cache_bytes_update(Edje_File *edf)
+{
+   if (!edf->cached) return;
+   _edje_file_cache_bytes -= edf->cache_bytes;
+   edf->cache_bytes = edf->size + edf->collection_cache_bytes;
+   _edje_file_cache_bytes += edf->cache_bytes;
+}
+
 void
-_edje_cache_coll_clean(Edje_File *edf)
+_edje_cache_coll_insert(Edje_File *edf, Edje_Part_Collection *edc)
 {
-   while ((edf->collection_cache) &&
-	  (eina_list_count(edf->collection_cache) > (unsigned int) _edje_collection_cache_size))
-     {
-	Edje_Part_Collection_Directory_Entry *ce;
-	Edje_Part_Collection *edc;
+   Edje_Part_Collection_Directory_Entry *ce;
 
-	edc = eina_list_data_get(eina_list_last(edf->collection_cache));
-	edf->collection_cache = eina_list_remove_list(edf->collection_cache, eina_list_last(edf->collection_cache));
+   ce = eina_hash_find(edf->collection, edc->part);
+   if (ce) ce->cached = edc;
+   edc->cache_bytes = _edje_collection_bytes(ce, edc);
+   edf->collection_cache = eina_inlist_prepend(edf->collection_cache, EINA_INLIST_GET(edc));
+   edf->collection_cache_count++;
+   edf->collection_cache_bytes += edc->cache_bytes;
+   _edje_file_cache_bytes_update(edf);
+}
 
-	ce = eina_hash_find(edf->collection, edc->part);
-	_edje_collection_free(edf, edc, ce);
-     }
+void
+_edje_cache_coll_remove(Edje_File *edf, Edje_Part_Collection *edc)
+{
+   Edje_Part_Collection_Directory_Entry *ce;
+
+   ce = eina_hash_find(edf->collection, edc->part);
+   if ((ce) && (ce->cached == edc)) ce->cached = NULL;
+   edf->collection_cache = eina_inlist_remove(edf->collection_cache, EINA_INLIST_GET(edc));
+   edf->collection_cache_count--;
+   edf->collection_cache_bytes -= edc->cache_bytes;
+   _edje_file_cache_bytes_update(edf);
+}
+
+static void
+_edje_cache_coll_evict(Edje_File *edf)
+{
+   Edje_Part_Collection_Directory_Entry *ce;
+   Edje_Part_Collection *edc;
+
+   edc = EINA_INLIST_CONTAINER_GET(edf->collection_cache->last, Edje_Part_Collection);
+   _edje_cache_coll_remove(edf, edc);
+
+   ce = eina_hash_find(edf->collection, edc->part);
+   _edje_collection_free(edf, edc, ce);
+}
+
+void
+_edje_cache_coll_clean(Edje_File *edf)
+{
+   while ((edf->collection_cache) &&
+	  ((edf->collection_cache_count > (unsigned int) _edje_collection_cache_size) ||
+	   ((_edje_collection_cache_bytes_max) &&
+	    (edf->collection_cache_bytes > _edje_collection_cache_bytes_max))))
+     _edje_cache_coll_evict(edf);
 }
 
 void
 _edje_cache_coll_flush(Edje_File *edf)
 {
    while (edf->collection_cache)
-     {
-	Edje_Part_Collection_Directory_Entry *ce;
-	Edje_Part_Collection *edc;
-	Eina_List *last;
-
-	last = eina_list_last(edf->collection_cache);
-	edc = eina_list_data_get(last);
-	edf->collection_cache = eina_list_remove_list(edf->collection_cache,
-						      last);
-
-	ce = eina_hash_find(edf->collection, edc->part);
-	_edje_collection_free(edf, edc, ce);
-     }
+     _edje_cache_coll_evict(edf);
 }
 
 void
@@ -499,28 +675,54 @@ _edje_cache_coll_unref(Edje_File *edf, Edje_Part_Collection *edc)
 	  }
 	else
 	  {
-	     edf->collection_cache = eina_list_prepend(edf->collection_cache, edc);
+	     _edje_cache_coll_insert(edf, edc);
 	     _edje_cache_coll_clean(edf);
 	  }
      }
 }
 
 static void
-_edje_cache_file_clean(void)
+_edje_file_cache_add(Edje_File *edf)
+{
+   if (!_edje_file_cache_hash)
+     _edje_file_cache_hash = eina_hash_string_small_new(NULL);
+   eina_hash_direct_add(_edje_file_cache_hash, edf->path, edf);
+   _edje_file_cache = eina_inlist_prepend(_edje_file_cache, EINA_INLIST_GET(edf));
+   edf->cache_bytes = edf->size + edf->collection_cache_bytes;
+   edf->cached = EINA_TRUE;
+   _edje_file_cache_count++;
+   _edje_file_cache_bytes += edf->cache_bytes;
+}
+
+static void
+_edje_file_cache_del(Edje_File *edf)
 {
-   int count;
+   eina_hash_del(_edje_file_cache_hash, edf->path, edf);
+   _edje_file_cache = eina_inlist_remove(_edje_file_cache, EINA_INLIST_GET(edf));
+   _edje_file_cache_count--;
+   _edje_file_cache_bytes -= edf->cache_bytes;
+   edf->cache_bytes = 0;
+   edf->cached = EINA_FALSE;
+   if (!_edje_file_cache)
+     {
+	eina_hash_free(_edje_file_cache_hash);
+	_edje_file_cache_hash = NULL;
+     }
+}
 
-   count = eina_list_count(_edje_file_cache);
-   while ((_edje_file_cache) && (count > _edje_file_cache_size))
+static void
+_edje_cache_file_clean(void)
+{
+   while ((_edje_file_cache) &&
+	  ((_edje_file_cache_count > (unsigned int) _edje_file_cache_size) ||
+	   ((_edje_file_cache_bytes_max) &&
+	    (_edje_file_cache_bytes > _edje_file_cache_bytes_max))))
      {
-	Eina_List *last;
 	Edje_File *edf;
 
-	last = eina_list_last(_edje_file_cache);
-	edf = eina_list_data_get(last);
-	_edje_file_cache = eina_list_remove_list(_edje_file_cache, last);
+	edf = EINA_INLIST_CONTAINER_GET(_edje_file_cache->last, Edje_File);
+	_edje_file_cache_del(edf);
 	_edje_file_free(edf);
-	count = eina_list_count(_edje_file_cache);
      }
 }
 
@@ -542,13 +744,104 @@ _edje_cache_file_unref(Edje_File *edf)
        eina_hash_free(_edje_file_hash);
        _edje_file_hash = NULL;
      }
-   _edje_file_cache = eina_list_prepend(_edje_file_cache, edf);
+   _edje_file_cache_add(edf);
    _edje_cache_file_clean();
 }
 
+static void
+_edje_collection_preload_run(void *data, Ecore_Thread *thread __UNUSED__)
+{
+   Edje_Collection_Preload *pl = data;
+
+   eina_lock_take(&_edje_collection_decode_lock);
+   if (!pl->taken)
+     {
+	pl->edc = _edje_file_coll_decode(pl->edf, pl->ce);
+	if (pl->edc) _edje_collection_patterns_build(pl->edc);
+     }
+   eina_lock_release(&_edje_collection_decode_lock);
+}
+
+static void
+_edje_collection_preload_end(void *data, Ecore_Thread *thread __UNUSED__)
+{
+   Edje_Collection_Preload *pl = data;
+   Edje_Part_Collection *edc = NULL;
+   Edje_File *edf;
+   int error_ret = EDJE_LOAD_ERROR_NONE;
+
+   _edje_collection_preloads = eina_list_remove(_edje_collection_preloads, pl);
+   if (pl->shutdown)
+     {
+	/* edje_shutdown() released everything else already */
+	free(pl);
+	return;
+     }
+
+   /* going through the cache runs the checks done on any collection the
+    * first time it is used, and takes over what the thread decoded */
+   edf = _edje_cache_file_coll_open(pl->file, pl->group, &error_ret, &edc, NULL);
+   if (!pl->taken)
+     {
+	Edje_Part_Collection *left;
+
+	/* the file was reloaded meanwhile, drop the stale decoding */
+	left = _edje_collection_preload_take(pl);
+	if (left) _edje_collection_free(pl->edf, left, pl->ce);
+     }
+
+   if (pl->func)
+     pl->func((void *) pl->data, pl->file, pl->group, !!edc);
+
+   if (edc) _edje_cache_coll_unref(edf, edc);
+   if (edf) _edje_cache_file_unref(edf);
+   _edje_cache_file_unref(pl->edf);
+   eina_stringshare_del(pl->file);
+   eina_stringshare_del(pl->group);
+   free(pl);
+}
+
 void
 _edje_file_cache_shutdown(void)
 {
+   Edje_Collection_Preload *pl;
+   Eina_List *l;
+
+   /* the threads still running must neither decode nor report anymore,
+    * taking the lock waits for one busy decoding, and what was decoded
+    * already is freed while its file is still around */
+   EINA_LIST_FOREACH(_edje_collection_preloads, l, pl)
+     {
+	Edje_Part_Collection *edc;
+
+	eina_lock_take(&_edje_collection_decode_lock);
+	pl->taken = EINA_TRUE;
+	pl->shutdown = EINA_TRUE;
+	edc = pl->edc;
+	pl->edc = NULL;
+	eina_lock_release(&_edje_collection_decode_lock);
+
+	if (pl->ce->preload == pl) pl->ce->preload = NULL;
+	if (edc) _edje_collection_free(pl->edf, edc, pl->ce);
+
+	/* so whoever waits for the group can let go of its data */
+	if (pl->func)
+	  pl->func((void *) pl->data, pl->file, pl->group, EINA_FALSE);
+
+	_edje_cache_file_unref(pl->edf);
+	eina_stringshare_del(pl->file);
+	eina_stringshare_del(pl->group);
+	pl->edf = NULL;
+	pl->ce = NULL;
+	pl->file = NULL;
+	pl->group = NULL;
+     }
+   if ((_edje_collection_decode_lock_ready) && (!_edje_collection_preloads))
+     {
+	eina_lock_free(&_edje_collection_decode_lock);
+	_edje_collection_decode_lock_ready = EINA_FALSE;
+     }
+
    edje_file_cache_flush();
 }
 
@@ -591,16 +884,127 @@ edje_file_cache_flush(void)
 
 
 EAPI void
-edje_collection_cache_set(int count)
+edje_file_cache_bytes_set(size_t bytes)
+{
+   _edje_file_cache_bytes_max = bytes;
+   _edje_cache_file_clean();
+}
+
+
+EAPI size_t
+edje_file_cache_bytes_get(void)
+{
+   return _edje_file_cache_bytes_max;
+}
+
+
+EAPI void
+edje_file_cache_revalidate_set(double interval)
+{
+   _edje_file_cache_revalidate = interval;
+}
+
+
+EAPI double
+edje_file_cache_revalidate_get(void)
+{
+   return _edje_file_cache_revalidate;
+}
+
+
+static Eina_Bool
+_edje_file_cache_invalidate_cb(const Eina_Hash *hash __UNUSED__, const void *key __UNUSED__, void *data, void *fdata __UNUSED__)
+{
+   Edje_File *edf = data;
+
+   edf->changed = EINA_TRUE;
+   return EINA_TRUE;
+}
+
+EAPI void
+edje_file_cache_invalidate(const char *file)
+{
+   Edje_File *edf;
+
+   if (_edje_file_hash)
+     {
+	if (file)
+	  {
+	     edf = eina_hash_find(_edje_file_hash, file);
+	     if (edf) edf->changed = EINA_TRUE;
+	  }
+	else
+	  eina_hash_foreach(_edje_file_hash, _edje_file_cache_invalidate_cb, NULL);
+     }
+   if (!_edje_file_cache_hash) return;
+   if (file)
+     {
+	edf = eina_hash_find(_edje_file_cache_hash, file);
+	if (edf) edf->changed = EINA_TRUE;
+     }
+   else
+     EINA_INLIST_FOREACH(_edje_file_cache, edf)
+       edf->changed = EINA_TRUE;
+}
+
+
+static Eina_Bool
+_edje_file_coll_clean_cb(const Eina_Hash *hash __UNUSED__, const void *key __UNUSED__, void *data, void *fdata __UNUSED__)
+{
+   _edje_cache_coll_clean(data);
+   return EINA_TRUE;
+}
+
+static void
+_edje_cache_coll_clean_all(void)
+{
+   Edje_File *edf;
+
+   EINA_INLIST_FOREACH(_edje_file_cache, edf)
+     _edje_cache_coll_clean(edf);
+   if (_edje_file_hash)
+     eina_hash_foreach(_edje_file_hash, _edje_file_coll_clean_cb, NULL);
+}
+
+static Eina_Bool
+_edje_coll_program_cache_trim_cb(const Eina_Hash *hash __UNUSED__, const void *key __UNUSED__, void *data, void *fdata __UNUSED__)
+{
+   Edje_Part_Collection_Directory_Entry *ce = data;
+
+   if (ce->ref) _edje_collection_program_cache_trim(ce->ref);
+   if (ce->cached) _edje_collection_program_cache_trim(ce->cached);
+   return EINA_TRUE;
+}
+
+static Eina_Bool
+_edje_file_program_cache_trim_cb(const Eina_Hash *hash __UNUSED__, const void *key __UNUSED__, void *data, void *fdata __UNUSED__)
+{
+   Edje_File *edf = data;
+
+   if (edf->collection)
+     eina_hash_foreach(edf->collection, _edje_coll_program_cache_trim_cb, NULL);
+   return EINA_TRUE;
+}
+
+/* the loaded collections, used or cached, keep their program caches */
+void
+_edje_cache_program_cache_trim_all(void)
 {
-   Eina_List *l;
    Edje_File *edf;
 
+   EINA_INLIST_FOREACH(_edje_file_cache, edf)
+     _edje_file_program_cache_trim_cb(NULL, NULL, edf, NULL);
+   if (_edje_file_hash)
+     eina_hash_foreach(_edje_file_hash, _edje_file_program_cache_trim_cb, NULL);
+}
+
+
+EAPI void
+edje_collection_cache_set(int count)
+{
    if (count < 0) count = 0;
    _edje_collection_cache_size = count;
-   EINA_LIST_FOREACH(_edje_file_cache, l, edf)
-     _edje_cache_coll_clean(edf);
-   /* FIXME: freach in file hash too! */
+   _edje_cache_coll_clean_all();
 }
 
 
@@ -611,17 +1015,85 @@ edje_collection_cache_get(void)
 }
 
 
+EAPI void
+edje_collection_cache_bytes_set(size_t bytes)
+{
+   _edje_collection_cache_bytes_max = bytes;
+   _edje_cache_coll_clean_all();
+}
+
+
+EAPI size_t
+edje_collection_cache_bytes_get(void)
+{
+   return _edje_collection_cache_bytes_max;
+}
+
+
 EAPI void
 edje_collection_cache_flush(void)
 {
    int ps;
-   Eina_List *l;
-   Edje_File *edf;
 
    ps = _edje_collection_cache_size;
    _edje_collection_cache_size = 0;
-   EINA_LIST_FOREACH(_edje_file_cache, l, edf)
-     _edje_cache_coll_flush(edf);
-   /* FIXME: freach in file hash too! */
+   _edje_cache_coll_clean_all();
    _edje_collection_cache_size = ps;
 }
+
+
+EAPI Eina_Bool
+edje_file_collection_preload(const char *file, const char *group, Edje_File_Preload_Cb func, const void *data)
+{
+   Edje_Part_Collection_Directory_Entry *ce;
+   Edje_Collection_Preload *pl;
+   Edje_File *edf;
+   int error_ret = EDJE_LOAD_ERROR_NONE;
+
+   if ((!file) || (!group)) return EINA_FALSE;
+
+   edf = _edje_cache_file_coll_open(file, NULL, &error_ret, NULL, NULL);
+   if (!edf) return EINA_FALSE;
+
+   ce = eina_hash_find(edf->collection, group);
+   if (!ce) goto on_error;
+
+   pl = calloc(1, sizeof (Edje_Collection_Preload));
+   if (!pl) goto on_error;
+
+   if (!_edje_collection_decode_lock_ready)
+     {
+	if (!eina_lock_new(&_edje_collection_decode_lock))
+	  {
+	     free(pl);
+	     goto on_error;
+	  }
+	_edje_collection_decode_lock_ready = EINA_TRUE;
+     }
+
+   pl->edf = edf;
+   pl->ce = ce;
+   pl->file = eina_stringshare_add(file);
+   pl->group = eina_stringshare_add(group);
+   pl->func = func;
+   pl->data = data;
+
+   /* already loaded or on its way, only the callback is left to run */
+   if ((ce->ref) || (ce->cached) || (ce->preload))
+     pl->taken = EINA_TRUE;
+   else
+     ce->preload = pl;
+
+   /* the end callback may run before this returns when threads are not
+    * available, so pl is not touched after */
+   _edje_collection_preloads = eina_list_append(_edje_collection_preloads, pl);
+   ecore_thread_run(_edje_collection_preload_run,
+		    _edje_collection_preload_end,
+		    _edje_collection_preload_end,
+		    pl);
+   return EINA_TRUE;
+
+ on_error:
+   _edje_cache_file_unref(edf);
+   return EINA_FALSE;
+}
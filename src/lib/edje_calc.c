@@ -11,14 +11,12 @@ static void _edje_part_recalc_single(Edje *ed, Edje_Real_Part *ep,
 				     Edje_Real_Part *confine_to, Edje_Calc_Params *params,
                                      FLOAT_T pos);
 
-void
-_edje_part_pos_set(Edje *ed, Edje_Real_Part *ep, int mode, FLOAT_T pos, FLOAT_T v1, FLOAT_T v2)
+FLOAT_T
+_edje_tween_pos_map(int mode, FLOAT_T pos, FLOAT_T v1, FLOAT_T v2)
 {
    FLOAT_T fp_pos;
    FLOAT_T npos;
 
-   pos = CLAMP(pos, ZERO, FROM_INT(1));
-
    fp_pos = pos;
 
    npos = ZERO;
@@ -111,15 +109,67 @@ _edje_part_pos_set(Edje *ed, Edje_Real_Part *ep, int mode, FLOAT_T pos, FLOAT_T
         break;
      }
 #endif
+   return npos;
+}
+
+/* the tween curve of a program sampled at EDJE_TWEEN_LUT_SIZE + 1 even
+ * steps, so running it costs a table lookup per frame instead of a call
+ * into ecore_animator_pos_map() for every target part */
+FLOAT_T
+_edje_program_tween_pos(Edje_Program *pr, FLOAT_T pos)
+{
+   Edje_Tween_Lut *lut;
+   FLOAT_T x;
+   int mode;
+   int i;
+
+   pos = CLAMP(pos, ZERO, FROM_INT(1));
+   mode = pr->tween.mode & EDJE_TWEEN_MODE_MASK;
+   if (mode == EDJE_TWEEN_MODE_LINEAR) return pos;
+
+   lut = pr->tween_lut;
+   /* edje_edit can change the curve of a program while it is loaded */
+   if ((!lut) || (lut->mode != mode) ||
+       (lut->v1 != pr->tween.v1) || (lut->v2 != pr->tween.v2))
+     {
+        if (!lut)
+          {
+             lut = malloc(sizeof (Edje_Tween_Lut));
+             if (!lut)
+               return _edje_tween_pos_map(mode, pos, pr->tween.v1, pr->tween.v2);
+             pr->tween_lut = lut;
+          }
+        lut->mode = mode;
+        lut->v1 = pr->tween.v1;
+        lut->v2 = pr->tween.v2;
+        for (i = 0; i <= EDJE_TWEEN_LUT_SIZE; i++)
+          lut->pos[i] = _edje_tween_pos_map(mode,
+                                            DIV(FROM_INT(i), FROM_INT(EDJE_TWEEN_LUT_SIZE)),
+                                            lut->v1, lut->v2);
+     }
+
+   x = MUL(pos, FROM_INT(EDJE_TWEEN_LUT_SIZE));
+   i = TO_INT(x);
+   if (i >= EDJE_TWEEN_LUT_SIZE) return lut->pos[EDJE_TWEEN_LUT_SIZE];
+   return ADD(lut->pos[i], MUL(SUB(x, FROM_INT(i)), SUB(lut->pos[i + 1], lut->pos[i])));
+}
+
+void
+_edje_part_tween_pos_set(Edje *ed, Edje_Real_Part *ep, FLOAT_T npos)
+{
    if (npos == ep->description_pos) return;
 
    ep->description_pos = npos;
 
-   ed->dirty = 1;
+   _edje_part_dirty_set(ed, ep);
    ed->recalc_call = 1;
-#ifdef EDJE_CALC_CACHE
-   ep->invalidate = 1;
-#endif
+}
+
+void
+_edje_part_pos_set(Edje *ed, Edje_Real_Part *ep, int mode, FLOAT_T pos, FLOAT_T v1, FLOAT_T v2)
+{
+   pos = CLAMP(pos, ZERO, FROM_INT(1));
+   _edje_part_tween_pos_set(ed, ep, _edje_tween_pos_map(mode, pos, v1, v2));
 }
 
 
@@ -256,6 +306,81 @@ _edje_get_description_by_orientation(Edje *ed, Edje_Part_Description_Common *src
    return desc_rtl;
 }
 
+static inline unsigned int
+_edje_part_description_index_hash(const char *name)
+{
+   uintptr_t h = (uintptr_t)name;
+
+   return (unsigned int)((h >> 3) ^ (h >> 11));
+}
+
+static Edje_Part_Description_Index *
+_edje_part_description_index_build(Edje_Part *ep)
+{
+   Edje_Part_Description_Index *idx;
+   Edje_Part_Description_Common *d, *o;
+   unsigned int size, h, i, s;
+
+   size = 8;
+   while (size < ep->other.desc_count * 2) size <<= 1;
+   idx = calloc(1, sizeof (Edje_Part_Description_Index)
+                + (size - 1) * sizeof (unsigned int));
+   if (!idx) return NULL;
+   idx->desc = ep->other.desc;
+   idx->desc_count = ep->other.desc_count;
+   idx->mask = size - 1;
+
+   for (i = 0; i < ep->other.desc_count; i++)
+     {
+        d = ep->other.desc[i];
+        if (!d->state.name) continue;
+        h = _edje_part_description_index_hash(d->state.name) & idx->mask;
+        while ((s = idx->slots[h]))
+          {
+             o = ep->other.desc[s - 1];
+             /* the first of two identical states wins, as in the scan */
+             if ((o->state.name == d->state.name) &&
+                 (o->state.value == d->state.value))
+               break;
+             h = (h + 1) & idx->mask;
+          }
+        if (!s) idx->slots[h] = i + 1;
+     }
+   return idx;
+}
+
+/* position in other.desc of the state with exactly this name pointer and
+ * value, -1 when the scan has to decide */
+static int
+_edje_part_description_index_find(Edje_Part *ep, const char *name, double val)
+{
+   Edje_Part_Description_Index *idx = ep->other_index;
+   Edje_Part_Description_Common *d;
+   unsigned int h, s;
+
+   /* edje_edit can add and remove states of a loaded part */
+   if ((!idx) || (idx->desc != ep->other.desc) ||
+       (idx->desc_count != ep->other.desc_count))
+     {
+        free(idx);
+        idx = ep->other_index = _edje_part_description_index_build(ep);
+        if (!idx) return -1;
+     }
+
+   h = _edje_part_description_index_hash(name) & idx->mask;
+   while ((s = idx->slots[h]))
+     {
+        if (s <= ep->other.desc_count)
+          {
+             d = ep->other.desc[s - 1];
+             if ((d->state.name == name) && (d->state.value == val))
+               return s - 1;
+          }
+        h = (h + 1) & idx->mask;
+     }
+   return -1;
+}
+
 Edje_Part_Description_Common *
 _edje_part_description_find(Edje *ed, Edje_Real_Part *rp, const char *name,
                             double val)
@@ -290,6 +415,15 @@ _edje_part_description_find(Edje *ed, Edje_Real_Part *rp, const char *name,
 
 	min_dst = ABS(ep->default_desc->state.value - val);
      }
+   else if (ep->other.desc_count)
+     {
+	int found;
+
+	found = _edje_part_description_index_find(ep, name, val);
+	if (found >= 0)
+	  return _edje_get_description_by_orientation(ed, ep->other.desc[found],
+		&ep->other.desc_rtl[found], ep->type);
+     }
 
    for (i = 0; i < ep->other.desc_count; ++i)
      {
@@ -511,8 +645,8 @@ _edje_real_part_rel_to_apply(Edje *ed, Edje_Real_Part *ep, Edje_Real_Part_State
 	     external = (Edje_Part_Description_External*) state->description;
 
 	     if (state->external_params)
-	       _edje_external_parsed_params_free(ep->swallowed_object, state->external_params);
-	     state->external_params = _edje_external_params_parse(ep->swallowed_object, external->external_params);
+	       _edje_external_parsed_params_free(ep->typedata.swallow->swallowed_object, state->external_params);
+	     state->external_params = _edje_external_params_parse(ep->typedata.swallow->swallowed_object, external->external_params);
 	  }
      }
 }
@@ -546,16 +680,17 @@ _edje_part_description_apply(Edje *ed, Edje_Real_Part *ep, const char *d1, doubl
 	    memset(ep->param2, 0, sizeof (Edje_Real_Part_State));
 	  }
 	else if (ep->part->type == EDJE_PART_TYPE_EXTERNAL)
-	  _edje_external_parsed_params_free(ep->swallowed_object, ep->param2->external_params);
+	  _edje_external_parsed_params_free(ep->typedata.swallow->swallowed_object, ep->param2->external_params);
 	ep->param2->external_params = NULL;
      }
    else
      if (ep->param2)
        {
 	  if (ep->part->type == EDJE_PART_TYPE_EXTERNAL)
-	    _edje_external_parsed_params_free(ep->swallowed_object, ep->param2->external_params);
+	    _edje_external_parsed_params_free(ep->typedata.swallow->swallowed_object, ep->param2->external_params);
 	  if (ep->param2)
 	    free(ep->param2->set);
+	  _edje_calc_cache_state_clean(ed, ep->param2);
 	  eina_mempool_free(_edje_real_part_state_mp, ep->param2);
 	  ep->param2 = NULL;
        }
@@ -581,11 +716,8 @@ _edje_part_description_apply(Edje *ed, Edje_Real_Part *ep, const char *d1, doubl
      _edje_external_recalc_apply(ed, ep, NULL, chosen_desc);
 
    ed->recalc_hints = 1;
-   ed->dirty = 1;
+   _edje_part_dirty_set(ed, ep);
    ed->recalc_call = 1;
-#ifdef EDJE_CALC_CACHE
-   ep->invalidate = 1;
-#endif
 }
 
 void
@@ -616,41 +748,276 @@ _edje_recalc(Edje *ed)
 //   ed->postponed = 1;
 }
 
+static void
+_edje_collection_dependency_add(unsigned int *count, unsigned int *list,
+                                unsigned int parts_count,
+                                int id, int dependent)
+{
+   if ((id < 0) || ((unsigned int) id >= parts_count) || (id == dependent))
+     return;
+   if (list) list[count[id]] = dependent;
+   count[id]++;
+}
+
+static void
+_edje_collection_description_dependencies_add(unsigned int *count, unsigned int *list,
+                                              unsigned int parts_count,
+                                              Edje_Part *ep,
+                                              Edje_Part_Description_Common *desc)
+{
+   if (!desc) return;
+
+#define EDJE_DEPENDENCY_ADD(Id) \
+   _edje_collection_dependency_add(count, list, parts_count, Id, ep->id);
+
+   EDJE_DEPENDENCY_ADD(desc->rel1.id_x);
+   EDJE_DEPENDENCY_ADD(desc->rel1.id_y);
+   EDJE_DEPENDENCY_ADD(desc->rel2.id_x);
+   EDJE_DEPENDENCY_ADD(desc->rel2.id_y);
+   EDJE_DEPENDENCY_ADD(desc->map.rot.id_center);
+   EDJE_DEPENDENCY_ADD(desc->map.id_light);
+   EDJE_DEPENDENCY_ADD(desc->map.id_persp);
+
+   switch (ep->type)
+     {
+      case EDJE_PART_TYPE_TEXT:
+      case EDJE_PART_TYPE_TEXTBLOCK:
+        {
+           Edje_Part_Description_Text *text;
+
+           text = (Edje_Part_Description_Text *) desc;
+           EDJE_DEPENDENCY_ADD(text->text.id_source);
+           EDJE_DEPENDENCY_ADD(text->text.id_text_source);
+           break;
+        }
+      case EDJE_PART_TYPE_PROXY:
+        {
+           Edje_Part_Description_Proxy *proxy;
+
+           proxy = (Edje_Part_Description_Proxy *) desc;
+           EDJE_DEPENDENCY_ADD(proxy->proxy.id);
+           break;
+        }
+      default:
+         break;
+     }
+#undef EDJE_DEPENDENCY_ADD
+}
+
+static void
+_edje_collection_dependencies_walk(Edje_Part_Collection *edc,
+                                   unsigned int *count, unsigned int *list)
+{
+   unsigned int i, j;
+
+   for (i = 0; i < edc->parts_count; ++i)
+     {
+        Edje_Part *ep;
+
+        ep = edc->parts[i];
+        _edje_collection_dependency_add(count, list, edc->parts_count,
+                                        ep->dragable.confine_id, ep->id);
+        _edje_collection_description_dependencies_add(count, list, edc->parts_count,
+                                                      ep, ep->default_desc);
+        for (j = 0; j < ep->other.desc_count; ++j)
+          _edje_collection_description_dependencies_add(count, list, edc->parts_count,
+                                                        ep, ep->other.desc[j]);
+     }
+}
+
+/* Build the reverse dependency graph of a collection: for each part id,
+ * the ids of all parts that use it as rel1/rel2 to_x/to_y, map center,
+ * light or perspective, confine, proxy or text source in any of their
+ * descriptions. It is stored as two flat arrays shared by all Edje of
+ * the group, dependents.list[index[id] .. index[id + 1] - 1]. */
+void
+_edje_collection_dependents_build(Edje_Part_Collection *edc)
+{
+   unsigned int *count;
+   unsigned int i;
+
+   if (edc->dependents.index) return;
+
+   edc->dependents.index = calloc(edc->parts_count + 1, sizeof (unsigned int));
+   if (!edc->dependents.index) return;
+
+   count = edc->dependents.index + 1;
+   _edje_collection_dependencies_walk(edc, count, NULL);
+
+   for (i = 1; i <= edc->parts_count; ++i)
+     edc->dependents.index[i] += edc->dependents.index[i - 1];
+
+   if (edc->dependents.index[edc->parts_count] > 0)
+     {
+        edc->dependents.list = malloc(sizeof (unsigned int) *
+                                      edc->dependents.index[edc->parts_count]);
+        if (!edc->dependents.list)
+          {
+             free(edc->dependents.index);
+             edc->dependents.index = NULL;
+             return;
+          }
+     }
+
+   /* count[id] now points at the first slot of id, walk again to fill
+      the list and shift the offsets back in place */
+   count = alloca(sizeof (unsigned int) * (edc->parts_count + 1));
+   memcpy(count, edc->dependents.index, sizeof (unsigned int) * (edc->parts_count + 1));
+   _edje_collection_dependencies_walk(edc, count, edc->dependents.list);
+}
+
+/* Also drops the recalc order coming from edje_cc, as both are wrong
+ * as soon as a relation or a part id changes. */
+void
+_edje_collection_dependents_clean(Edje_Part_Collection *edc)
+{
+   free(edc->dependents.index);
+   free(edc->dependents.list);
+   edc->dependents.index = NULL;
+   edc->dependents.list = NULL;
+
+   free(edc->recalc_order.parts);
+   edc->recalc_order.parts = NULL;
+   edc->recalc_order.parts_count = 0;
+}
+
+void
+_edje_part_dirty_set(Edje *ed, Edje_Real_Part *ep)
+{
+   ep->dirty = 1;
+   ed->partial_dirty = 1;
+   ep->invalidate = 1;
+}
+
+/* Flag for recalc only the parts that changed since the last recalc and
+ * every part that depends on them, directly or not. Everything else keeps
+ * the geometry from the previous pass. Returns EINA_FALSE if a full recalc
+ * is needed. */
+static Eina_Bool
+_edje_recalc_partial_prepare(Edje *ed)
+{
+   Edje_Part_Collection *edc = ed->collection;
+   Edje_Real_Part **stack;
+   unsigned int count = 0;
+   unsigned int i;
+
+   if ((!edc) || (edc->parts_count != ed->table_parts_size)) return EINA_FALSE;
+   if (!edc->dependents.index) _edje_collection_dependents_build(edc);
+   if (!edc->dependents.index) return EINA_FALSE;
+
+   stack = alloca(sizeof (Edje_Real_Part *) * ed->table_parts_size);
+   for (i = 0; i < ed->table_parts_size; i++)
+     {
+	Edje_Real_Part *ep;
+
+	ep = ed->table_parts[i];
+        /* custom states can point anywhere, they are not in the graph */
+        if ((ep->custom) &&
+            ((ep->param1.description == ep->custom->description) ||
+             ((ep->param2) && (ep->param2->description == ep->custom->description))))
+          return EINA_FALSE;
+        if ((ep->part->id < 0) || ((unsigned int) ep->part->id >= edc->parts_count))
+          return EINA_FALSE;
+
+	ep->calculating = FLAG_NONE;
+        if (ep->dirty)
+          {
+             ep->calculated = FLAG_NONE;
+             stack[count++] = ep;
+          }
+        else
+          ep->calculated = FLAG_XY;
+     }
+
+   while (count > 0)
+     {
+        Edje_Real_Part *ep;
+        unsigned int j;
+        int id;
+
+        ep = stack[--count];
+        id = ep->part->id;
+        for (j = edc->dependents.index[id]; j < edc->dependents.index[id + 1]; j++)
+          {
+             Edje_Real_Part *dep;
+
+             dep = ed->table_parts[edc->dependents.list[j]];
+             if (dep->dirty) continue;
+
+             /* not _edje_part_dirty_set(), the object flags were already
+              * consumed by this pass and must not queue another one */
+             dep->dirty = 1;
+             dep->invalidate = 1;
+             dep->calculated = FLAG_NONE;
+             stack[count++] = dep;
+          }
+     }
+
+   return EINA_TRUE;
+}
+
 void
 _edje_recalc_do(Edje *ed)
 {
    unsigned int i;
    Eina_Bool need_calc;
+   Eina_Bool full;
 
 // XXX: dont need this with current smart calc infra. remove me later
 //   ed->postponed = 0;
    need_calc = evas_object_smart_need_recalculate_get(ed->obj);
    evas_object_smart_need_recalculate_set(ed->obj, 0);
-   if (!ed->dirty) return;
-   ed->have_mapped_part = 0;
+   if ((!ed->dirty) && (!ed->partial_dirty)) return;
+   full = ed->dirty;
    ed->dirty = 0;
+   ed->partial_dirty = 0;
    ed->state++;
-   for (i = 0; i < ed->table_parts_size; i++)
+   if ((!full) && (ed->calc_only || !_edje_recalc_partial_prepare(ed)))
+     full = EINA_TRUE;
+   if (full)
      {
-	Edje_Real_Part *ep;
+        ed->have_mapped_part = 0;
+        for (i = 0; i < ed->table_parts_size; i++)
+          {
+             Edje_Real_Part *ep;
 
-	ep = ed->table_parts[i];
-	ep->calculated = FLAG_NONE;
-	ep->calculating = FLAG_NONE;
+             ep = ed->table_parts[i];
+             ep->calculated = FLAG_NONE;
+             ep->calculating = FLAG_NONE;
+          }
      }
-   for (i = 0; i < ed->table_parts_size; i++)
+   if ((ed->collection) &&
+       (ed->collection->recalc_order.parts_count == ed->table_parts_size))
      {
-	Edje_Real_Part *ep;
+        Edje_Part_Order *order = ed->collection->recalc_order.parts;
 
-	ep = ed->table_parts[i];
-	if (ep->calculated != FLAG_XY)
-          _edje_part_recalc(ed, ep, (~ep->calculated) & FLAG_XY, NULL);
+        /* dependencies always come first, _edje_part_recalc() will not
+           need to recurse unless a custom state moved a relation */
+        for (i = 0; i < ed->table_parts_size; i++)
+          {
+             Edje_Real_Part *ep;
+
+             ep = ed->table_parts[order[i].part % ed->table_parts_size];
+             ep->dirty = 0;
+             if (ep->calculated != FLAG_XY)
+               _edje_part_recalc(ed, ep, (~ep->calculated) & FLAG_XY, NULL);
+          }
+     }
+   else
+     {
+        for (i = 0; i < ed->table_parts_size; i++)
+          {
+             Edje_Real_Part *ep;
+
+             ep = ed->table_parts[i];
+             ep->dirty = 0;
+             if (ep->calculated != FLAG_XY)
+               _edje_part_recalc(ed, ep, (~ep->calculated) & FLAG_XY, NULL);
+          }
      }
    if (!ed->calc_only) ed->recalc = 0;
-#ifdef EDJE_CALC_CACHE
    ed->all_part_change = 0;
    ed->text_part_change = 0;
-#endif
    if (!ed->calc_only)
      {
         if (ed->recalc_call)
@@ -819,9 +1186,7 @@ _edje_dragable_pos_set(Edje *ed, Edje_Real_Part *ep, FLOAT_T x, FLOAT_T y)
         ed->recalc_call = 1;
      }
 
-#ifdef EDJE_CALC_CACHE
    ep->invalidate = 1;
-#endif
    _edje_recalc(ed); /* won't do anything if dirty flag isn't set */
 }
 
@@ -907,11 +1272,12 @@ _edje_part_recalc_single_aspect(Edje *ed,
         evas_object_image_size_get(ep->object, &w, &h);
         amin = amax = DIV(FROM_INT(w), FROM_INT(h));
      }
-   if ((ep->swallow_params.aspect.w > 0) &&
-       (ep->swallow_params.aspect.h > 0))
+   if ((ep->type == EDJE_RP_TYPE_SWALLOW) &&
+       (ep->typedata.swallow->swallow_params.aspect.w > 0) &&
+       (ep->typedata.swallow->swallow_params.aspect.h > 0))
      amin = amax =
-       DIV(FROM_INT(ep->swallow_params.aspect.w),
-	   FROM_INT(ep->swallow_params.aspect.h));
+       DIV(FROM_INT(ep->typedata.swallow->swallow_params.aspect.w),
+	   FROM_INT(ep->typedata.swallow->swallow_params.aspect.h));
    want_x = FROM_INT(params->x);
    want_w = new_w = FROM_INT(params->w);
 
@@ -921,9 +1287,10 @@ _edje_part_recalc_single_aspect(Edje *ed,
    if ((amin > ZERO) && (amax > ZERO))
      {
 	apref = desc->aspect.prefer;
-	if (ep->swallow_params.aspect.mode > EDJE_ASPECT_CONTROL_NONE)
+	if ((ep->type == EDJE_RP_TYPE_SWALLOW) &&
+	    (ep->typedata.swallow->swallow_params.aspect.mode > EDJE_ASPECT_CONTROL_NONE))
 	  {
-	     switch (ep->swallow_params.aspect.mode)
+	     switch (ep->typedata.swallow->swallow_params.aspect.mode)
 	       {
 		case EDJE_ASPECT_CONTROL_NEITHER:
 		   apref = EDJE_ASPECT_PREFER_NONE;
@@ -1146,14 +1513,14 @@ _edje_part_recalc_single_textblock(FLOAT_T sc,
 
 	if (chosen_desc->text.id_source >= 0)
 	  {
-	     ep->text.source = ed->table_parts[chosen_desc->text.id_source % ed->table_parts_size];
+	     ep->typedata.text->source = ed->table_parts[chosen_desc->text.id_source % ed->table_parts_size];
 
-	     tmp = edje_string_get(&((Edje_Part_Description_Text *)ep->text.source->chosen_description)->text.style);
+	     tmp = edje_string_get(&((Edje_Part_Description_Text *)ep->typedata.text->source->chosen_description)->text.style);
 	     if (tmp) style = tmp;
 	  }
 	else
 	  {
-	     ep->text.source = NULL;
+	     ep->typedata.text->source = NULL;
 
 	     tmp = edje_string_get(&chosen_desc->text.style);
 	     if (tmp) style = tmp;
@@ -1161,16 +1528,16 @@ _edje_part_recalc_single_textblock(FLOAT_T sc,
 
 	if (chosen_desc->text.id_text_source >= 0)
 	  {
-	     ep->text.text_source = ed->table_parts[chosen_desc->text.id_text_source % ed->table_parts_size];
-	     text = edje_string_get(&((Edje_Part_Description_Text*)ep->text.text_source->chosen_description)->text.text);
+	     ep->typedata.text->text_source = ed->table_parts[chosen_desc->text.id_text_source % ed->table_parts_size];
+	     text = edje_string_get(&((Edje_Part_Description_Text*)ep->typedata.text->text_source->chosen_description)->text.text);
 
-	     if (ep->text.text_source->text.text) text = ep->text.text_source->text.text;
+	     if (ep->typedata.text->text_source->typedata.text->text) text = ep->typedata.text->text_source->typedata.text->text;
 	  }
 	else
 	  {
-	     ep->text.text_source = NULL;
+	     ep->typedata.text->text_source = NULL;
 	     text = edje_string_get(&chosen_desc->text.text);
-	     if (ep->text.text) text = ep->text.text;
+	     if (ep->typedata.text->text) text = ep->typedata.text->text;
 	  }
 
 	EINA_LIST_FOREACH(ed->file->styles, l, stl)
@@ -1368,45 +1735,45 @@ _edje_part_recalc_single_text(FLOAT_T sc __UNUSED__,
 	/* Update a object_text part */
 
 	if (chosen_desc->text.id_source >= 0)
-	  ep->text.source = ed->table_parts[chosen_desc->text.id_source % ed->table_parts_size];
+	  ep->typedata.text->source = ed->table_parts[chosen_desc->text.id_source % ed->table_parts_size];
 	else
-	  ep->text.source = NULL;
+	  ep->typedata.text->source = NULL;
 
 	if (chosen_desc->text.id_text_source >= 0)
-	  ep->text.text_source = ed->table_parts[chosen_desc->text.id_text_source % ed->table_parts_size];
+	  ep->typedata.text->text_source = ed->table_parts[chosen_desc->text.id_text_source % ed->table_parts_size];
 	else
-	  ep->text.text_source = NULL;
+	  ep->typedata.text->text_source = NULL;
 
-	if (ep->text.text_source)
-	  text = edje_string_get(&(((Edje_Part_Description_Text*)ep->text.text_source->chosen_description)->text.text));
+	if (ep->typedata.text->text_source)
+	  text = edje_string_get(&(((Edje_Part_Description_Text*)ep->typedata.text->text_source->chosen_description)->text.text));
 	else
 	  text = edje_string_get(&chosen_desc->text.text);
 
-	if (ep->text.source)
-	  font = _edje_text_class_font_get(ed, ((Edje_Part_Description_Text*)ep->text.source->chosen_description), &size, &sfont);
+	if (ep->typedata.text->source)
+	  font = _edje_text_class_font_get(ed, ((Edje_Part_Description_Text*)ep->typedata.text->source->chosen_description), &size, &sfont);
 	else
 	  font = _edje_text_class_font_get(ed, chosen_desc, &size, &sfont);
 
 	if (!font) font = "";
 
-	if (ep->text.text_source)
+	if (ep->typedata.text->text_source)
 	  {
-	     if (ep->text.text_source->text.text) text = ep->text.text_source->text.text;
+	     if (ep->typedata.text->text_source->typedata.text->text) text = ep->typedata.text->text_source->typedata.text->text;
 	  }
 	else
 	  {
-	     if (ep->text.text) text = ep->text.text;
+	     if (ep->typedata.text->text) text = ep->typedata.text->text;
 	  }
 
-	if (ep->text.source)
+	if (ep->typedata.text->source)
 	  {
-	     if (ep->text.source->text.font) font = ep->text.source->text.font;
-	     if (ep->text.source->text.size > 0) size = ep->text.source->text.size;
+	     if (ep->typedata.text->source->typedata.text->font) font = ep->typedata.text->source->typedata.text->font;
+	     if (ep->typedata.text->source->typedata.text->size > 0) size = ep->typedata.text->source->typedata.text->size;
 	  }
 	else
 	  {
-	     if (ep->text.font) font = ep->text.font;
-	     if (ep->text.size > 0) size = ep->text.size;
+	     if (ep->typedata.text->font) font = ep->typedata.text->font;
+	     if (ep->typedata.text->size > 0) size = ep->typedata.text->size;
 	  }
 	if (!text) text = "";
 
@@ -1800,10 +2167,15 @@ _edje_part_recalc_single_min_max(FLOAT_T sc,
 				 int *minw, int *minh,
 				 int *maxw, int *maxh)
 {
+   Edje_Real_Part_Swallow *swallow = NULL;
+
+   if (ep->type == EDJE_RP_TYPE_SWALLOW)
+     swallow = ep->typedata.swallow;
+
    *minw = desc->min.w;
    if (ep->part->scale) *minw = TO_INT(SCALE(sc, *minw));
-   if (ep->swallow_params.min.w > desc->min.w)
-     *minw = ep->swallow_params.min.w;
+   if ((swallow) && (swallow->swallow_params.min.w > desc->min.w))
+     *minw = swallow->swallow_params.min.w;
 
    if (ep->edje->calc_only)
      {
@@ -1815,8 +2187,9 @@ _edje_part_recalc_single_min_max(FLOAT_T sc,
      }
 
    /* XXX TODO: remove need of EDJE_INF_MAX_W, see edje_util.c */
-   if ((ep->swallow_params.max.w <= 0) ||
-       (ep->swallow_params.max.w == EDJE_INF_MAX_W))
+   if ((!swallow) ||
+       (swallow->swallow_params.max.w <= 0) ||
+       (swallow->swallow_params.max.w == EDJE_INF_MAX_W))
      {
 	*maxw = desc->max.w;
 	if (*maxw > 0)
@@ -1828,7 +2201,7 @@ _edje_part_recalc_single_min_max(FLOAT_T sc,
    else
      {
 	if (desc->max.w <= 0)
-	  *maxw = ep->swallow_params.max.w;
+	  *maxw = swallow->swallow_params.max.w;
 	else
 	  {
 	     *maxw = desc->max.w;
@@ -1837,8 +2210,8 @@ _edje_part_recalc_single_min_max(FLOAT_T sc,
 		  if (ep->part->scale) *maxw = TO_INT(SCALE(sc, *maxw));
 		  if (*maxw < 1) *maxw = 1;
 	       }
-	     if (ep->swallow_params.max.w < *maxw)
-	       *maxw = ep->swallow_params.max.w;
+	     if (swallow->swallow_params.max.w < *maxw)
+	       *maxw = swallow->swallow_params.max.w;
 	  }
      }
    if ((ep->edje->calc_only) && (desc->minmul.have) && 
@@ -1850,8 +2223,8 @@ _edje_part_recalc_single_min_max(FLOAT_T sc,
 
    *minh = desc->min.h;
    if (ep->part->scale) *minh = TO_INT(SCALE(sc, *minh));
-   if (ep->swallow_params.min.h > desc->min.h)
-     *minh = ep->swallow_params.min.h;
+   if ((swallow) && (swallow->swallow_params.min.h > desc->min.h))
+     *minh = swallow->swallow_params.min.h;
 
    if (ep->edje->calc_only)
      {
@@ -1863,8 +2236,9 @@ _edje_part_recalc_single_min_max(FLOAT_T sc,
      }
 
    /* XXX TODO: remove need of EDJE_INF_MAX_H, see edje_util.c */
-   if ((ep->swallow_params.max.h <= 0) ||
-       (ep->swallow_params.max.h == EDJE_INF_MAX_H))
+   if ((!swallow) ||
+       (swallow->swallow_params.max.h <= 0) ||
+       (swallow->swallow_params.max.h == EDJE_INF_MAX_H))
      {
 	*maxh = desc->max.h;
 	if (*maxh > 0)
@@ -1876,7 +2250,7 @@ _edje_part_recalc_single_min_max(FLOAT_T sc,
    else
      {
 	if (desc->max.h <= 0)
-	  *maxh = ep->swallow_params.max.h;
+	  *maxh = swallow->swallow_params.max.h;
 	else
 	  {
 	     *maxh = desc->max.h;
@@ -1885,8 +2259,8 @@ _edje_part_recalc_single_min_max(FLOAT_T sc,
 		  if (ep->part->scale) *maxh = TO_INT(SCALE(sc, *maxh));
 		  if (*maxh < 1) *maxh = 1;
 	       }
-	     if (ep->swallow_params.max.h < *maxh)
-	       *maxh = ep->swallow_params.max.h;
+	     if (swallow->swallow_params.max.h < *maxh)
+	       *maxh = swallow->swallow_params.max.h;
 	  }
      }
    if ((ep->edje->calc_only) && (desc->minmul.have) && 
@@ -2267,7 +2641,7 @@ _edje_proxy_recalc_apply(Edje *ed, Edje_Real_Part *ep, Edje_Calc_Params *p3, Edj
       case EDJE_PART_TYPE_GROUP:
       case EDJE_PART_TYPE_SWALLOW:
       case EDJE_PART_TYPE_EXTERNAL:
-         evas_object_image_source_set(ep->object, pp->swallowed_object);
+         evas_object_image_source_set(ep->object, pp->typedata.swallow->swallowed_object);
          break;
       case EDJE_PART_TYPE_SPACER:
          /* FIXME: detect that at compile time and prevent it */
@@ -2319,6 +2693,52 @@ _edje_image_recalc_apply(Edje *ed, Edje_Real_Part *ep, Edje_Calc_Params *p3, Edj
    _edje_real_part_image_set(ed, ep, pos);
 }
 
+/* Pick where the params of a part state are computed. Without calc cache
+ * it is always the caller stack. With it, the params are kept from one
+ * recalc to the next, but only once a state was seen again with unchanged
+ * inputs: parts that change on every pass never allocate anything. Returns
+ * EINA_FALSE when *p already holds the right values. */
+static Eina_Bool
+_edje_calc_cache_params_get(Edje *ed, Edje_Real_Part_State *st,
+                            Edje_Calc_Params *local, Edje_Calc_Params **p,
+                            Eina_Bool changed)
+{
+   *p = local;
+   if (!ed->calc_cache) return EINA_TRUE;
+
+   if (st->p)
+     {
+        *p = st->p;
+        if (!changed)
+          {
+             ed->calc_cache_stats.hits++;
+             return EINA_FALSE;
+          }
+     }
+   else if (!changed)
+     {
+        st->p = malloc(sizeof (Edje_Calc_Params));
+        if (st->p)
+          {
+             ed->calc_cache_stats.bytes += sizeof (Edje_Calc_Params);
+             *p = st->p;
+          }
+     }
+
+   ed->calc_cache_stats.misses++;
+   return EINA_TRUE;
+}
+
+void
+_edje_calc_cache_state_clean(Edje *ed, Edje_Real_Part_State *st)
+{
+   if (!st || !st->p) return;
+
+   free(st->p);
+   st->p = NULL;
+   ed->calc_cache_stats.bytes -= sizeof (Edje_Calc_Params);
+}
+
 static Edje_Real_Part *
 _edje_real_part_state_get(Edje *ed, Edje_Real_Part *ep, int flags, int id, int *state)
 {
@@ -2330,27 +2750,33 @@ _edje_real_part_state_get(Edje *ed, Edje_Real_Part *ep, int flags, int id, int *
         if (result)
           {
 	    if (!result->calculated) _edje_part_recalc(ed, result, flags, NULL);
-#ifdef EDJE_CALC_CACHE
              if (state) *state = result->state;
-#else
-             (void) state;
-#endif
           }
      }
    return result;
 }
 
+/* interpolate a packed run of int params. The callers gather the fields
+ * into local arrays first, so the loop is one flat run the compiler can
+ * vectorize. It gives the same result as INTP(), an unchanged field keeps
+ * its exact value since SCALE() of a zero delta is zero. */
+static inline void
+_edje_calc_params_intp(int *r, const int *a, const int *b, int n, FLOAT_T pos)
+{
+   int i;
+
+   for (i = 0; i < n; i++)
+     r[i] = TO_INT(ADD(FROM_INT(a[i]), SCALE(pos, b[i] - a[i])));
+}
+
 void
 _edje_part_recalc(Edje *ed, Edje_Real_Part *ep, int flags, Edje_Calc_Params *state)
 {
-#ifdef EDJE_CALC_CACHE
    Eina_Bool proxy_invalidate = EINA_FALSE;
    int state1 = -1;
    int state2 = -1;
    int statec = -1;
-#else
    Edje_Calc_Params lp1, lp2;
-#endif
    int statec1 = -1;
    int statec2 = -1;
    int statel1 = -1;
@@ -2365,6 +2791,7 @@ _edje_part_recalc(Edje *ed, Edje_Real_Part *ep, int flags, Edje_Calc_Params *sta
    Edje_Real_Part *confine_to = NULL;
    FLOAT_T pos = ZERO, pos2;
    Edje_Calc_Params lp3;
+   int a[8], b[8], r[8]; /* packed runs for _edje_calc_params_intp() */
 
    /* GRADIENT ARE GONE, WE MUST IGNORE IT FROM OLD FILE. */
    if (ep->part->type == EDJE_PART_TYPE_GRADIENT)
@@ -2409,24 +2836,22 @@ _edje_part_recalc(Edje *ed, Edje_Real_Part *ep, int flags, Edje_Calc_Params *sta
 
    if (ep->part->scale &&
        ep->part->type == EDJE_PART_TYPE_GROUP &&
-       ep->swallowed_object)
+       ep->typedata.swallow->swallowed_object)
      {
-        edje_object_scale_set(ep->swallowed_object, TO_DOUBLE(ed->scale));
+        edje_object_scale_set(ep->typedata.swallow->swallowed_object, TO_DOUBLE(ed->scale));
 
         if (ep->description_pos > FROM_DOUBLE(0.5) && ep->param2)
           {
-             edje_object_update_hints_set(ep->swallowed_object, ep->param2->description->min.limit);
+             edje_object_update_hints_set(ep->typedata.swallow->swallowed_object, ep->param2->description->min.limit);
           }
         else
           {
-             edje_object_update_hints_set(ep->swallowed_object, ep->param1.description->min.limit);
+             edje_object_update_hints_set(ep->typedata.swallow->swallowed_object, ep->param1.description->min.limit);
           }
      }
 
-#ifdef EDJE_CALC_CACHE
-   if (ep->state == ed->state && !state)
+   if (ed->calc_cache && ep->state == ed->state && !state)
      return ;
-#endif
 
    if (flags & FLAG_X)
      {
@@ -2434,34 +2859,26 @@ _edje_part_recalc(Edje *ed, Edje_Real_Part *ep, int flags, Edje_Calc_Params *sta
 	if (ep->param1.rel1_to_x)
 	  {
 	    _edje_part_recalc(ed, ep->param1.rel1_to_x, FLAG_X, NULL);
-#ifdef EDJE_CALC_CACHE
 	     state1 = ep->param1.rel1_to_x->state;
-#endif
 	  }
 	if (ep->param1.rel2_to_x)
 	  {
 	    _edje_part_recalc(ed, ep->param1.rel2_to_x, FLAG_X, NULL);
-#ifdef EDJE_CALC_CACHE
 	     if (state1 < ep->param1.rel2_to_x->state)
 	       state1 = ep->param1.rel2_to_x->state;
-#endif
 	  }
 	if (ep->param2)
 	  {
 	     if (ep->param2->rel1_to_x)
 	       {
 		 _edje_part_recalc(ed, ep->param2->rel1_to_x, FLAG_X, NULL);
-#ifdef EDJE_CALC_CACHE
 		  state2 = ep->param2->rel1_to_x->state;
-#endif
 	       }
 	     if (ep->param2->rel2_to_x)
 	       {
 		 _edje_part_recalc(ed, ep->param2->rel2_to_x, FLAG_X, NULL);
-#ifdef EDJE_CALC_CACHE
 		  if (state2 < ep->param2->rel2_to_x->state)
 		    state2 = ep->param2->rel2_to_x->state;
-#endif
 	       }
 	  }
      }
@@ -2471,36 +2888,28 @@ _edje_part_recalc(Edje *ed, Edje_Real_Part *ep, int flags, Edje_Calc_Params *sta
 	if (ep->param1.rel1_to_y)
 	  {
 	    _edje_part_recalc(ed, ep->param1.rel1_to_y, FLAG_Y, NULL);
-#ifdef EDJE_CALC_CACHE
 	     if (state1 < ep->param1.rel1_to_y->state)
 	       state1 = ep->param1.rel1_to_y->state;
-#endif
 	  }
 	if (ep->param1.rel2_to_y)
 	  {
 	    _edje_part_recalc(ed, ep->param1.rel2_to_y, FLAG_Y, NULL);
-#ifdef EDJE_CALC_CACHE
 	     if (state1 < ep->param1.rel2_to_y->state)
 	       state1 = ep->param1.rel2_to_y->state;
-#endif
 	  }
 	if (ep->param2)
 	  {
 	     if (ep->param2->rel1_to_y)
 	       {
 		 _edje_part_recalc(ed, ep->param2->rel1_to_y, FLAG_Y, NULL);
-#ifdef EDJE_CALC_CACHE
 		  if (state2 < ep->param2->rel1_to_y->state)
 		    state2 = ep->param2->rel1_to_y->state;
-#endif
 	       }
 	     if (ep->param2->rel2_to_y)
 	       {
 		 _edje_part_recalc(ed, ep->param2->rel2_to_y, FLAG_Y, NULL);
-#ifdef EDJE_CALC_CACHE
 		  if (state2 < ep->param2->rel2_to_y->state)
 		    state2 = ep->param2->rel2_to_y->state;
-#endif
 	       }
 	  }
      }
@@ -2508,9 +2917,7 @@ _edje_part_recalc(Edje *ed, Edje_Real_Part *ep, int flags, Edje_Calc_Params *sta
      {
 	confine_to = ep->drag->confine_to;
 	_edje_part_recalc(ed, confine_to, flags, NULL);
-#ifdef EDJE_CALC_CACHE
 	statec = confine_to->state;
-#endif
      }
 //   if (ep->text.source)       _edje_part_recalc(ed, ep->text.source, flags);
 //   if (ep->text.text_source)  _edje_part_recalc(ed, ep->text.text_source, flags);
@@ -2537,9 +2944,7 @@ _edje_part_recalc(Edje *ed, Edje_Real_Part *ep, int flags, Edje_Calc_Params *sta
           part_id = ((Edje_Part_Description_Proxy*) chosen_desc)->proxy.id;
 
         pp = _edje_real_part_state_get(ed, ep, flags, part_id, NULL);
-#ifdef EDJE_CALC_CACHE
         if (pp && pp->invalidate) proxy_invalidate = EINA_TRUE;
-#endif
      }
 
    /* Recalc if needed the map center && light source */
@@ -2565,36 +2970,29 @@ _edje_part_recalc(Edje *ed, Edje_Real_Part *ep, int flags, Edje_Calc_Params *sta
           }
      }
 
-#ifndef EDJE_CALC_CACHE
    p1 = &lp1;
-#else
-   p1 = &ep->param1.p;
-#endif
 
    if (ep->param1.description)
      {
-#ifdef EDJE_CALC_CACHE
-	if (ed->all_part_change ||
- 	    ep->invalidate ||
- 	    state1 >= ep->param1.state ||
- 	    statec >= ep->param1.state ||
-            statec1 >= ep->param1.state ||
-            statel1 >= ep->param1.state ||
-            statep1 >= ep->param1.state ||
-            proxy_invalidate ||
-            state ||
- 	    ((ep->part->type == EDJE_PART_TYPE_TEXT || ep->part->type == EDJE_PART_TYPE_TEXTBLOCK) && ed->text_part_change))
-#endif
+	if (_edje_calc_cache_params_get(ed, &ep->param1, &lp1, &p1,
+                                        ed->all_part_change ||
+                                        ep->invalidate ||
+                                        state1 >= ep->param1.state ||
+                                        statec >= ep->param1.state ||
+                                        statec1 >= ep->param1.state ||
+                                        statel1 >= ep->param1.state ||
+                                        statep1 >= ep->param1.state ||
+                                        proxy_invalidate ||
+                                        state ||
+                                        ((ep->part->type == EDJE_PART_TYPE_TEXT || ep->part->type == EDJE_PART_TYPE_TEXTBLOCK) && ed->text_part_change)))
  	  {
  	     _edje_part_recalc_single(ed, ep, ep->param1.description, chosen_desc, center[0], light[0], persp[0],
   				      ep->param1.rel1_to_x, ep->param1.rel1_to_y, ep->param1.rel2_to_x, ep->param1.rel2_to_y,
  				      confine_to,
  				      p1, pos);
 
-#ifdef EDJE_CALC_CACHE
 	     if (flags == FLAG_XY)
 	       ep->param1.state = ed->state;
-#endif
  	  }
      }
    if (ep->param2)
@@ -2618,22 +3016,17 @@ _edje_part_recalc(Edje *ed, Edje_Real_Part *ep, int flags, Edje_Calc_Params *sta
 
  	p3 = &lp3;
 
-#ifndef EDJE_CALC_CACHE
- 	p2 = &lp2;
-#else
- 	p2 = &ep->param2->p;
-
-	if (ed->all_part_change ||
- 	    ep->invalidate ||
- 	    state2 >= ep->param2->state ||
- 	    statec >= ep->param2->state ||
-            statec2 >= ep->param2->state ||
-            statel2 >= ep->param2->state ||
-            statep2 >= ep->param2->state ||
-            proxy_invalidate ||
-            state ||
- 	    ((ep->part->type == EDJE_PART_TYPE_TEXT || ep->part->type == EDJE_PART_TYPE_TEXTBLOCK) && ed->text_part_change))
-#endif
+	if (_edje_calc_cache_params_get(ed, ep->param2, &lp2, &p2,
+                                        ed->all_part_change ||
+                                        ep->invalidate ||
+                                        state2 >= ep->param2->state ||
+                                        statec >= ep->param2->state ||
+                                        statec2 >= ep->param2->state ||
+                                        statel2 >= ep->param2->state ||
+                                        statep2 >= ep->param2->state ||
+                                        proxy_invalidate ||
+                                        state ||
+                                        ((ep->part->type == EDJE_PART_TYPE_TEXT || ep->part->type == EDJE_PART_TYPE_TEXTBLOCK) && ed->text_part_change)))
  	  {
  	     _edje_part_recalc_single(ed, ep, ep->param2->description, 
                                       chosen_desc, 
@@ -2644,10 +3037,8 @@ _edje_part_recalc(Edje *ed, Edje_Real_Part *ep, int flags, Edje_Calc_Params *sta
                                       ep->param2->rel2_to_y,
  				      confine_to,
 				      p2, pos);
-#ifdef EDJE_CALC_CACHE
 	     if (flags == FLAG_XY)
 	       ep->param2->state = ed->state;
-#endif
  	  }
 
 	pos2 = pos;
@@ -2680,15 +3071,14 @@ _edje_part_recalc(Edje *ed, Edje_Real_Part *ep, int flags, Edje_Calc_Params *sta
 
 #define INTP(_x1, _x2, _p) TO_INT(FINTP(_x1, _x2, _p))
 
-	p3->x = INTP(p1->x, p2->x, pos);
- 	p3->y = INTP(p1->y, p2->y, pos);
- 	p3->w = INTP(p1->w, p2->w, pos);
- 	p3->h = INTP(p1->h, p2->h, pos);
-
-	p3->req.x = INTP(p1->req.x, p2->req.x, pos);
- 	p3->req.y = INTP(p1->req.y, p2->req.y, pos);
- 	p3->req.w = INTP(p1->req.w, p2->req.w, pos);
- 	p3->req.h = INTP(p1->req.h, p2->req.h, pos);
+	/* x, y, w, h and req */
+	a[0] = p1->x; a[1] = p1->y; a[2] = p1->w; a[3] = p1->h;
+	a[4] = p1->req.x; a[5] = p1->req.y; a[6] = p1->req.w; a[7] = p1->req.h;
+	b[0] = p2->x; b[1] = p2->y; b[2] = p2->w; b[3] = p2->h;
+	b[4] = p2->req.x; b[5] = p2->req.y; b[6] = p2->req.w; b[7] = p2->req.h;
+	_edje_calc_params_intp(r, a, b, 8, pos);
+	p3->x = r[0]; p3->y = r[1]; p3->w = r[2]; p3->h = r[3];
+	p3->req.x = r[4]; p3->req.y = r[5]; p3->req.w = r[6]; p3->req.h = r[7];
         
  	if (ep->part->dragable.x)
 	  {
@@ -2701,37 +3091,48 @@ _edje_part_recalc(Edje *ed, Edje_Real_Part *ep, int flags, Edje_Calc_Params *sta
  	     p3->req_drag.h = INTP(p1->req_drag.h, p2->req_drag.h, pos);
  	  }
 
-	p3->color.r = INTP(p1->color.r, p2->color.r, pos2);
- 	p3->color.g = INTP(p1->color.g, p2->color.g, pos2);
- 	p3->color.b = INTP(p1->color.b, p2->color.b, pos2);
- 	p3->color.a = INTP(p1->color.a, p2->color.a, pos2);
+	a[0] = p1->color.r; a[1] = p1->color.g; a[2] = p1->color.b; a[3] = p1->color.a;
+	b[0] = p2->color.r; b[1] = p2->color.g; b[2] = p2->color.b; b[3] = p2->color.a;
+	_edje_calc_params_intp(r, a, b, 4, pos2);
+	p3->color.r = r[0]; p3->color.g = r[1]; p3->color.b = r[2]; p3->color.a = r[3];
 
   	switch (part_type)
   	  {
   	   case EDJE_PART_TYPE_IMAGE:
-	      p3->type.common.spec.image.l = INTP(p1->type.common.spec.image.l, p2->type.common.spec.image.l, pos);
-	      p3->type.common.spec.image.r = INTP(p1->type.common.spec.image.r, p2->type.common.spec.image.r, pos);
-	      p3->type.common.spec.image.t = INTP(p1->type.common.spec.image.t, p2->type.common.spec.image.t, pos);
-	      p3->type.common.spec.image.b = INTP(p1->type.common.spec.image.b, p2->type.common.spec.image.b, pos);
+	      a[0] = p1->type.common.spec.image.l; a[1] = p1->type.common.spec.image.r;
+	      a[2] = p1->type.common.spec.image.t; a[3] = p1->type.common.spec.image.b;
+	      b[0] = p2->type.common.spec.image.l; b[1] = p2->type.common.spec.image.r;
+	      b[2] = p2->type.common.spec.image.t; b[3] = p2->type.common.spec.image.b;
+	      _edje_calc_params_intp(r, a, b, 4, pos);
+	      p3->type.common.spec.image.l = r[0]; p3->type.common.spec.image.r = r[1];
+	      p3->type.common.spec.image.t = r[2]; p3->type.common.spec.image.b = r[3];
               p3->type.common.spec.image.border_scale_by = INTP(p1->type.common.spec.image.border_scale_by, p2->type.common.spec.image.border_scale_by, pos);
            case EDJE_PART_TYPE_PROXY:
- 	      p3->type.common.fill.x = INTP(p1->type.common.fill.x, p2->type.common.fill.x, pos);
- 	      p3->type.common.fill.y = INTP(p1->type.common.fill.y, p2->type.common.fill.y, pos);
- 	      p3->type.common.fill.w = INTP(p1->type.common.fill.w, p2->type.common.fill.w, pos);
- 	      p3->type.common.fill.h = INTP(p1->type.common.fill.h, p2->type.common.fill.h, pos);
+	      a[0] = p1->type.common.fill.x; a[1] = p1->type.common.fill.y;
+	      a[2] = p1->type.common.fill.w; a[3] = p1->type.common.fill.h;
+	      b[0] = p2->type.common.fill.x; b[1] = p2->type.common.fill.y;
+	      b[2] = p2->type.common.fill.w; b[3] = p2->type.common.fill.h;
+	      _edje_calc_params_intp(r, a, b, 4, pos);
+	      p3->type.common.fill.x = r[0]; p3->type.common.fill.y = r[1];
+	      p3->type.common.fill.w = r[2]; p3->type.common.fill.h = r[3];
   	      break;
   	   case EDJE_PART_TYPE_TEXT:
  	      p3->type.text.size = INTP(p1->type.text.size, p2->type.text.size, pos);
   	   case EDJE_PART_TYPE_TEXTBLOCK:
- 	      p3->type.text.color2.r = INTP(p1->type.text.color2.r, p2->type.text.color2.r, pos2);
- 	      p3->type.text.color2.g = INTP(p1->type.text.color2.g, p2->type.text.color2.g, pos2);
-	      p3->type.text.color2.b = INTP(p1->type.text.color2.b, p2->type.text.color2.b, pos2);
- 	      p3->type.text.color2.a = INTP(p1->type.text.color2.a, p2->type.text.color2.a, pos2);
-
- 	      p3->type.text.color3.r = INTP(p1->type.text.color3.r, p2->type.text.color3.r, pos2);
-	      p3->type.text.color3.g = INTP(p1->type.text.color3.g, p2->type.text.color3.g, pos2);
-	      p3->type.text.color3.b = INTP(p1->type.text.color3.b, p2->type.text.color3.b, pos2);
-	      p3->type.text.color3.a = INTP(p1->type.text.color3.a, p2->type.text.color3.a, pos2);
+	      /* color2 then color3 */
+	      a[0] = p1->type.text.color2.r; a[1] = p1->type.text.color2.g;
+	      a[2] = p1->type.text.color2.b; a[3] = p1->type.text.color2.a;
+	      a[4] = p1->type.text.color3.r; a[5] = p1->type.text.color3.g;
+	      a[6] = p1->type.text.color3.b; a[7] = p1->type.text.color3.a;
+	      b[0] = p2->type.text.color2.r; b[1] = p2->type.text.color2.g;
+	      b[2] = p2->type.text.color2.b; b[3] = p2->type.text.color2.a;
+	      b[4] = p2->type.text.color3.r; b[5] = p2->type.text.color3.g;
+	      b[6] = p2->type.text.color3.b; b[7] = p2->type.text.color3.a;
+	      _edje_calc_params_intp(r, a, b, 8, pos2);
+	      p3->type.text.color2.r = r[0]; p3->type.text.color2.g = r[1];
+	      p3->type.text.color2.b = r[2]; p3->type.text.color2.a = r[3];
+	      p3->type.text.color3.r = r[4]; p3->type.text.color3.g = r[5];
+	      p3->type.text.color3.b = r[6]; p3->type.text.color3.a = r[7];
 
 	      p3->type.text.align.x = FFP(p1->type.text.align.x, p2->type.text.align.x, pos);
 	      p3->type.text.align.y = FFP(p1->type.text.align.y, p2->type.text.align.y, pos);
@@ -2939,7 +3340,8 @@ _edje_part_recalc(Edje *ed, Edje_Real_Part *ep, int flags, Edje_Calc_Params *sta
               break;
 	  }
 
-	if (ep->swallowed_object)
+	if ((ep->type == EDJE_RP_TYPE_SWALLOW) &&
+	    ep->typedata.swallow->swallowed_object)
 	  {
 //// the below really is wrong - swallow color shouldn't affect swallowed object
 //// color - the edje color as a WHOLE should though - and that should be
@@ -2952,12 +3354,12 @@ _edje_part_recalc(Edje *ed, Edje_Real_Part *ep, int flags, Edje_Calc_Params *sta
 //				   pf->color.a);
 	     if (pf->visible)
 	       {
-		  evas_object_move(ep->swallowed_object, ed->x + pf->x, ed->y + pf->y);
-		  evas_object_resize(ep->swallowed_object, pf->w, pf->h);
-		  evas_object_show(ep->swallowed_object);
+		  evas_object_move(ep->typedata.swallow->swallowed_object, ed->x + pf->x, ed->y + pf->y);
+		  evas_object_resize(ep->typedata.swallow->swallowed_object, pf->w, pf->h);
+		  evas_object_show(ep->typedata.swallow->swallowed_object);
 	       }
-	     else evas_object_hide(ep->swallowed_object);
-             mo = ep->swallowed_object;
+	     else evas_object_hide(ep->typedata.swallow->swallowed_object);
+             mo = ep->typedata.swallow->swallowed_object;
 	  }
         else mo = ep->object;
         if (chosen_desc->map.on && ep->part->type != EDJE_PART_TYPE_SPACER)
@@ -3036,11 +3438,9 @@ _edje_part_recalc(Edje *ed, Edje_Real_Part *ep, int flags, Edje_Calc_Params *sta
    ep->calculated |= flags;
    ep->calculating = FLAG_NONE;
 
-#ifdef EDJE_CALC_CACHE
    if (ep->calculated == FLAG_XY)
      {
 	ep->state = ed->state;
 	ep->invalidate = 0;
      }
-#endif
 }
@@ -187,9 +187,7 @@ _edje_mouse_up_signal_cb(void *data, Evas *e __UNUSED__, Evas_Object *obj, void
 		  rp->drag->need_reset = 1;
                   ed->recalc_call = 1;
 		  ed->dirty = 1;
-#ifdef EDJE_CALC_CACHE
 		  rp->invalidate = 1;
-#endif
 		  if (!ignored)
 		    _edje_emit(ed, "drag,stop", rp->part->name);
 	       }
@@ -267,9 +265,7 @@ _edje_mouse_move_signal_cb(void *data, Evas *e __UNUSED__, Evas_Object *obj, voi
 	       rp->drag->tmp.y = ev->cur.canvas.y - rp->drag->down.y;
              ed->recalc_call = 1;
 	     ed->dirty = 1;
-#ifdef EDJE_CALC_CACHE
 	     rp->invalidate = 1;
-#endif
 	  }
 	_edje_recalc_do(ed);
 
@@ -286,9 +282,7 @@ _edje_mouse_move_signal_cb(void *data, Evas *e __UNUSED__, Evas_Object *obj, voi
 		    _edje_emit(ed, "drag", rp->part->name);
                   ed->recalc_call = 1;
 		  ed->dirty = 1;
-#ifdef EDJE_CALC_CACHE
 		  rp->invalidate = 1;
-#endif
 		  _edje_recalc_do(ed);
 	       }
 	  }
@@ -319,66 +313,41 @@ _edje_mouse_wheel_signal_cb(void *data, Evas *e __UNUSED__, Evas_Object *obj, vo
 Eina_Bool
 _edje_timer_cb(void *data __UNUSED__)
 {
+   static unsigned int tick = 0;
    double t;
-   Eina_List *l;
-   Eina_List *animl = NULL;
-   Edje *ed;
+   unsigned int count, i;
 
    t = ecore_loop_time_get();
-   EINA_LIST_FOREACH(_edje_animators, l, ed)
+   tick++;
+   /* objects that start animating during the walk are appended past
+    * count, the ones that stop leave a hole until the walk ends */
+   count = _edje_animators_walk_begin();
+   for (i = 0; i < count; i++)
      {
-	_edje_ref(ed);
-	animl = eina_list_append(animl, ed);
-     }
-   while (animl)
-     {
-	Eina_List *newl = NULL;
+	Edje *ed;
 
-	ed = eina_list_data_get(animl);
+	ed = _edje_animators[i];
+	if (!ed) continue;
+	if (_edje_animator_skip(ed, tick)) continue;
+	_edje_ref(ed);
 	_edje_block(ed);
 	_edje_freeze(ed);
-	animl = eina_list_remove(animl, eina_list_data_get(animl));
 	if ((!ed->paused) && (!ed->delete_me))
 	  {
-	     const void *tmp;
+	     unsigned int n, j;
 
 	     ed->walking_actions = 1;
-	     EINA_LIST_FOREACH(ed->actions, l, tmp)
-	       newl = eina_list_append(newl, tmp);
-	     while (newl)
+	     n = ed->actions_count;
+	     for (j = 0; (j < n) && (j < ed->actions_count); j++)
 	       {
 		  Edje_Running_Program *runp;
 
-		  runp = eina_list_data_get(newl);
-		  newl = eina_list_remove(newl, eina_list_data_get(newl));
+		  runp = ed->actions[j];
 		  if (!runp->delete_me)
 		    _edje_program_run_iterate(runp, t);
-		  if (_edje_block_break(ed))
-		    {
-		       eina_list_free(newl);
-		       newl = NULL;
-		       goto break_prog;
-		    }
-	       }
-	     EINA_LIST_FOREACH(ed->actions, l, tmp)
-	       newl = eina_list_append(newl, tmp);
-	     while (newl)
-	       {
-		  Edje_Running_Program *runp;
-
-		  runp = eina_list_data_get(newl);
-		  newl = eina_list_remove(newl, eina_list_data_get(newl));
-		  if (runp->delete_me)
-		    {
-		       _edje_anim_count--;
-		       runp->edje->actions =
-			 eina_list_remove(runp->edje->actions, runp);
-		       if (!runp->edje->actions)
-			 _edje_animators =
-			 eina_list_remove(_edje_animators, runp->edje);
-		       free(runp);
-		    }
+		  if (_edje_block_break(ed)) goto break_prog;
 	       }
+	     _edje_running_programs_compact(ed);
 	     ed->walking_actions = 0;
 	  }
 	break_prog:
@@ -386,6 +355,7 @@ _edje_timer_cb(void *data __UNUSED__)
 	_edje_thaw(ed);
 	_edje_unref(ed);
      }
+   _edje_animators_walk_end();
    if (_edje_anim_count > 0) return ECORE_CALLBACK_RENEW;
    _edje_timer = NULL;
    return ECORE_CALLBACK_CANCEL;
@@ -159,6 +159,8 @@ _edje_edit_smart_add(Evas_Object *obj)
      }
 
    _edje_edit_parent_sc->base.add(obj);
+   /* descriptions are modified in place, so the results can't be shared */
+   eed->base.size_min_cache = 0;
 }
 
 static void
@@ -349,40 +351,48 @@ _edje_real_part_free(Edje_Real_Part *rp)
 	evas_object_del(rp->object);
      }
 
-   if (rp->swallowed_object)
+   if ((rp->type == EDJE_RP_TYPE_SWALLOW) &&
+       (rp->typedata.swallow->swallowed_object))
      {
-	evas_object_smart_member_del(rp->swallowed_object);
-	evas_object_event_callback_del(rp->swallowed_object,
+	evas_object_smart_member_del(rp->typedata.swallow->swallowed_object);
+	evas_object_event_callback_del(rp->typedata.swallow->swallowed_object,
 				       EVAS_CALLBACK_FREE,
 				       _edje_object_part_swallow_free_cb);
-	evas_object_clip_unset(rp->swallowed_object);
-	evas_object_data_del(rp->swallowed_object, "\377 edje.swallowing_part");
+	evas_object_clip_unset(rp->typedata.swallow->swallowed_object);
+	evas_object_data_del(rp->typedata.swallow->swallowed_object, "\377 edje.swallowing_part");
 	if (rp->part->mouse_events)
-	  _edje_callbacks_del(rp->swallowed_object, rp->edje);
+	  _edje_callbacks_del(rp->typedata.swallow->swallowed_object, rp->edje);
 
 	if (rp->part->type == EDJE_PART_TYPE_GROUP ||
 	    rp->part->type == EDJE_PART_TYPE_EXTERNAL)
-	  evas_object_del(rp->swallowed_object);
+	  evas_object_del(rp->typedata.swallow->swallowed_object);
 
-	rp->swallowed_object = NULL;
+	rp->typedata.swallow->swallowed_object = NULL;
      }
 
-   if (rp->text.text) eina_stringshare_del(rp->text.text);
-   if (rp->text.font) eina_stringshare_del(rp->text.font);
-   if (rp->text.cache.in_str) eina_stringshare_del(rp->text.cache.in_str);
-   if (rp->text.cache.out_str) eina_stringshare_del(rp->text.cache.out_str);
+   if (rp->type == EDJE_RP_TYPE_TEXT)
+     {
+	if (rp->typedata.text->text) eina_stringshare_del(rp->typedata.text->text);
+	if (rp->typedata.text->font) eina_stringshare_del(rp->typedata.text->font);
+	if (rp->typedata.text->cache.in_str) eina_stringshare_del(rp->typedata.text->cache.in_str);
+	if (rp->typedata.text->cache.out_str) eina_stringshare_del(rp->typedata.text->cache.out_str);
+     }
 
    if (rp->custom)
      {
 	_edje_collection_free_part_description_clean(rp->part->type, rp->custom->description, 0);
         if (rp->custom) free(rp->custom->set);
+        _edje_calc_cache_state_clean(rp->edje, rp->custom);
         eina_mempool_free(_edje_real_part_state_mp, rp->custom);
 	rp->custom = NULL;
      }
 
    free(rp->drag);
+   _edje_real_part_typedata_free(rp);
 
+   _edje_calc_cache_state_clean(rp->edje, &rp->param1);
    if (rp->param2) free(rp->param2->set);
+   _edje_calc_cache_state_clean(rp->edje, rp->param2);
    eina_mempool_free(_edje_real_part_state_mp, rp->param2);
 
    _edje_unref(rp->edje);
@@ -604,6 +614,8 @@ _edje_part_id_set(Edje *ed, Edje_Real_Part *rp, int new_id)
 
    old_id = part->id;
    part->id = new_id;
+   _edje_collection_size_min_clean(ed->collection);
+   _edje_collection_dependents_clean(ed->collection);
 
    /* Fix all the dependecies in all parts... */
    for (j = 0; j < ed->collection->parts_count; ++j)
@@ -706,6 +718,8 @@ _edje_parts_id_switch(Edje *ed, Edje_Real_Part *rp1, Edje_Real_Part *rp2)
    /* Switch ids */
    rp1->part->id = id2;
    rp2->part->id = id1;
+   _edje_collection_size_min_clean(ed->collection);
+   _edje_collection_dependents_clean(ed->collection);
 
    /* adjust table_parts */
    ed->table_parts[id1] = rp2;
@@ -1035,7 +1049,7 @@ edje_edit_group_add(Evas_Object *obj, const char *name)
    EDIT_EMN(SPACER, Edje_Part_Description_Common, de);
    EDIT_EMN(part, Edje_Part, de);
 
-   ed->file->collection_cache = eina_list_prepend(ed->file->collection_cache, pc);
+   _edje_cache_coll_insert(ed->file, pc);
    _edje_cache_coll_clean(ed->file);
 
    return EINA_TRUE;
@@ -1046,8 +1060,6 @@ edje_edit_group_del(Evas_Object *obj, const char *group_name)
 {
    Edje_Part_Collection_Directory_Entry *e;
    Edje_Part_Collection *die = NULL;
-   Edje_Part_Collection *g;
-   Eina_List *l;
    Eet_File *eetf;
    char buf[64], **keys;
    int count;
@@ -1086,14 +1098,11 @@ edje_edit_group_del(Evas_Object *obj, const char *group_name)
 
    _edje_edit_group_references_update(obj, group_name, NULL);
 
-   EINA_LIST_FOREACH(ed->file->collection_cache, l, g)
-     if (g->id == e->id)
-       {
-	  ed->file->collection_cache =
-	    eina_list_remove_list(ed->file->collection_cache, l);
-	  die = g;
-	  break;
-       }
+   if (e->cached)
+     {
+	die = e->cached;
+	_edje_cache_coll_remove(ed->file, die);
+     }
 
    /* Remove collection/id from eet file */
    eetf = eet_open(ed->file->path, EET_FILE_MODE_READ_WRITE);
@@ -1997,6 +2006,7 @@ edje_edit_part_name_set(Evas_Object *obj, const char* part, const char* new_name
 
    _edje_if_string_free(ed, rp->part->name);
    rp->part->name = (char *)eina_stringshare_add(new_name);
+   _edje_collection_part_names_clean(ed->collection);
 
    _edje_edit_flag_script_dirty(eed, EINA_TRUE);
 
@@ -2058,12 +2068,23 @@ _edje_edit_real_part_add(Evas_Object *obj, const char *name, Edje_Part_Type type
      }
    memset(rp, 0, sizeof(Edje_Real_Part));
 
+   /* Alloc the type specific data of the Edje_Real_Part */
+   ep->type = type;
+   rp->part = ep;
+   if (!_edje_real_part_typedata_new(rp))
+     {
+	eina_mempool_free(ce->mp.part, ep);
+	eina_mempool_free(_edje_real_part_mp, rp);
+	return EINA_FALSE;
+     }
+
    /* Init Edje_Part */
    pc = ed->collection;
 
    tmp = realloc(pc->parts, (pc->parts_count + 1) * sizeof (Edje_Part *));
    if (!tmp)
      {
+	_edje_real_part_typedata_free(rp);
 	eina_mempool_free(ce->mp.part, ep);
 	eina_mempool_free(_edje_real_part_mp, rp);
 	return EINA_FALSE;
@@ -2163,13 +2184,20 @@ _edje_edit_real_part_add(Evas_Object *obj, const char *name, Edje_Part_Type type
 			     sizeof(Edje_Real_Part *) * ed->table_parts_size);
 
    ed->table_parts[ep->id % ed->table_parts_size] = rp;
+   _edje_collection_part_names_clean(pc);
+   _edje_collection_size_min_clean(pc);
+   _edje_collection_dependents_clean(pc);
 
    /* Create default description */
    if (!edje_edit_state_add(obj, name, "default", 0.0))
      {
+	_edje_collection_part_names_clean(pc);
+	_edje_collection_size_min_clean(pc);
+	_edje_collection_dependents_clean(pc);
 	_edje_if_string_free(ed, ep->name);
 	if (source)
 	  _edje_if_string_free(ed, ep->source);
+	_edje_real_part_typedata_free(rp);
 	eina_mempool_free(ce->mp.part, ep);
 	eina_mempool_free(_edje_real_part_mp, rp);
 	return EINA_FALSE;
@@ -2228,8 +2256,11 @@ edje_edit_part_del(Evas_Object *obj, const char* part)
 	if (i == id) continue; //don't check the deleted id
 	real = ed->table_parts[i];
 
-	if (real->text.source == rp) real->text.source = NULL;
-	if (real->text.text_source == rp) real->text.text_source = NULL;
+	if (real->type == EDJE_RP_TYPE_TEXT)
+	  {
+	     if (real->typedata.text->source == rp) real->typedata.text->source = NULL;
+	     if (real->typedata.text->text_source == rp) real->typedata.text->text_source = NULL;
+	  }
 
 	if (real->param1.rel1_to_x == rp) real->param1.rel1_to_x = NULL;
 	if (real->param1.rel1_to_y == rp) real->param1.rel1_to_y = NULL;
@@ -2273,6 +2304,9 @@ edje_edit_part_del(Evas_Object *obj, const char* part)
 	memmove(&pc->parts[id], &pc->parts[id+1], mcount);
      }
    pc->parts[pc->parts_count] = NULL;
+   _edje_collection_part_names_clean(pc);
+   _edje_collection_size_min_clean(pc);
+   _edje_collection_dependents_clean(pc);
    _edje_fix_parts_id(ed);
 
    /* Free Edje_Part and all descriptions */
@@ -2289,6 +2323,7 @@ edje_edit_part_del(Evas_Object *obj, const char* part)
      _edje_collection_free_part_description_free(ep->type, ep->other.desc[k], ce, 0);
 
    free(ep->other.desc);
+   free(ep->other_index);
    eina_mempool_free(ce->mp.part, ep);
 
    /* Free Edje_Real_Part */
@@ -2374,8 +2409,9 @@ edje_edit_part_restack_below(Evas_Object *obj, const char* part)
    _edje_parts_id_switch(ed, rp, prev);
 
    evas_object_stack_below(rp->object, prev->object);
-   if (rp->swallowed_object)
-     evas_object_stack_above(rp->swallowed_object, rp->object);
+   if ((rp->type == EDJE_RP_TYPE_SWALLOW) &&
+       (rp->typedata.swallow->swallowed_object))
+     evas_object_stack_above(rp->typedata.swallow->swallowed_object, rp->object);
 
    _edje_edit_flag_script_dirty(eed, EINA_TRUE);
 
@@ -2410,8 +2446,9 @@ edje_edit_part_restack_above(Evas_Object *obj, const char* part)
    _edje_parts_id_switch(ed, rp, next);
 
    evas_object_stack_above(rp->object, next->object);
-   if (rp->swallowed_object)
-     evas_object_stack_above(rp->swallowed_object, rp->object);
+   if ((rp->type == EDJE_RP_TYPE_SWALLOW) &&
+       (rp->typedata.swallow->swallowed_object))
+     evas_object_stack_above(rp->typedata.swallow->swallowed_object, rp->object);
 
    _edje_edit_flag_script_dirty(eed, EINA_TRUE);
 
@@ -2506,8 +2543,9 @@ edje_edit_part_clip_to_set(Evas_Object *obj, const char *part, const char *clip_
 	  }
 
 	evas_object_clip_set(rp->object, ed->base.clipper);
-	if (rp->swallowed_object)
-	  evas_object_clip_set(rp->swallowed_object, ed->base.clipper);
+	if ((rp->type == EDJE_RP_TYPE_SWALLOW) &&
+	    (rp->typedata.swallow->swallowed_object))
+	  evas_object_clip_set(rp->typedata.swallow->swallowed_object, ed->base.clipper);
 
 	rp->part->clip_to_id = -1;
 	rp->clip_to = NULL;
@@ -2535,8 +2573,9 @@ edje_edit_part_clip_to_set(Evas_Object *obj, const char *part, const char *clip_
    evas_object_pass_events_set(rp->clip_to->object, 1);
    evas_object_pointer_mode_set(rp->clip_to->object, EVAS_OBJECT_POINTER_MODE_NOGRAB);
    evas_object_clip_set(rp->object, rp->clip_to->object);
-   if (rp->swallowed_object)
-     evas_object_clip_set(rp->swallowed_object, rp->clip_to->object);
+   if ((rp->type == EDJE_RP_TYPE_SWALLOW) &&
+       (rp->typedata.swallow->swallowed_object))
+     evas_object_clip_set(rp->typedata.swallow->swallowed_object, rp->clip_to->object);
 
    edje_object_calc_force(obj);
 
@@ -2681,11 +2720,12 @@ edje_edit_part_source_set(Evas_Object *obj, const char *part, const char *source
 
    _edje_if_string_free(ed, rp->part->source);
 
-   if (rp->swallowed_object)
+   if ((rp->type == EDJE_RP_TYPE_SWALLOW) &&
+       (rp->typedata.swallow->swallowed_object))
      {
        _edje_real_part_swallow_clear(rp);
-       evas_object_del(rp->swallowed_object);
-       rp->swallowed_object = NULL;
+       evas_object_del(rp->typedata.swallow->swallowed_object);
+       rp->typedata.swallow->swallowed_object = NULL;
      }
    if (source)
      {
@@ -2953,6 +2993,8 @@ edje_edit_state_del(Evas_Object *obj, const char *part, const char *state, doubl
        }
 
    _edje_collection_free_part_description_free(rp->part->type, pd, ce, 0);
+   /* the cached min sizes may point at the freed description */
+   _edje_collection_size_min_clean(ed->collection);
    return EINA_TRUE;
 }
 
@@ -3195,7 +3237,7 @@ edje_edit_state_add(Evas_Object *obj, const char *part, const char *name, double
 		  pi++;
 	       }
 	     if (external->external_params)
-	       rp->param1.external_params = _edje_external_params_parse(rp->swallowed_object, external->external_params);
+	       rp->param1.external_params = _edje_external_params_parse(rp->typedata.swallow->swallowed_object, external->external_params);
 	  }
      }
    else if (rp->part->type == EDJE_PART_TYPE_BOX)
@@ -3213,6 +3255,8 @@ edje_edit_state_add(Evas_Object *obj, const char *part, const char *name, double
 	memset(&table->table, 0, sizeof (table->table));
      }
 
+   _edje_collection_size_min_clean(ed->collection);
+
    return EINA_TRUE;
 }
 
@@ -3392,6 +3436,9 @@ edje_edit_state_copy(Evas_Object *obj, const char *part, const char *from, doubl
 
 #undef PD_STRING_COPY
 
+   _edje_collection_size_min_clean(ed->collection);
+   _edje_collection_dependents_clean(ed->collection);
+
    return EINA_TRUE;
 }
 
@@ -3409,6 +3456,7 @@ edje_edit_state_copy(Evas_Object *obj, const char *part, const char *from, doubl
      eina_error_set(0);							\
      GET_PD_OR_RETURN();						\
      pd->Sub.relative_##Value = FROM_DOUBLE(v);			\
+     _edje_collection_size_min_clean(ed->collection);			\
      edje_object_calc_force(obj);				\
   }
 
@@ -3431,6 +3479,7 @@ FUNC_STATE_RELATIVE_DOUBLE(rel2, y);
      eina_error_set(0);							\
      GET_PD_OR_RETURN();						\
      pd->Sub.offset_##Value = TO_INT(FROM_DOUBLE(v));		\
+     _edje_collection_size_min_clean(ed->collection);			\
      edje_object_calc_force(obj);					\
   }
 
@@ -3473,6 +3522,8 @@ FUNC_STATE_OFFSET_INT(rel2, y);
        }								\
      else								\
        pd->Sub.id_##Value = -1;					\
+     _edje_collection_size_min_clean(ed->collection);		\
+     _edje_collection_dependents_clean(ed->collection);		\
 									\
   }
 //note after this call edje_edit_part_selected_state_set() to update !! need to fix this
@@ -3508,6 +3559,7 @@ FUNC_STATE_REL(rel2, y);
      if (b > -1 && b < 256) pd->Code.b = b;				\
      if (a > -1 && a < 256) pd->Code.a = a;				\
      									\
+     _edje_collection_size_min_clean(ed->collection);			\
      edje_object_calc_force(obj);					\
   }
 
@@ -3578,6 +3630,7 @@ edje_edit_state_color3_set(Evas_Object *obj, const char *part, const char *state
      eina_error_set(0);							\
      GET_PD_OR_RETURN();						\
      pd->Class.Value = FROM_DOUBLE(v);				\
+     _edje_collection_size_min_clean(ed->collection);			\
      edje_object_calc_force(obj);					\
   }
 
@@ -3595,6 +3648,7 @@ edje_edit_state_color3_set(Evas_Object *obj, const char *part, const char *state
      eina_error_set(0);							\
      GET_PD_OR_RETURN();						\
      pd->Class.Value = v;					\
+     _edje_collection_size_min_clean(ed->collection);			\
      edje_object_calc_force(obj);					\
   }
 
@@ -3670,6 +3724,7 @@ FUNC_STATE_DOUBLE(aspect, max);
 	 return;							\
        }								\
 									\
+     _edje_collection_size_min_clean(ed->collection);			\
      edje_object_calc_force(obj);					\
   }
 
@@ -3733,6 +3788,7 @@ FUNC_STATE_DOUBLE(aspect, max);
 	 return;							\
        }								\
 									\
+     _edje_collection_size_min_clean(ed->collection);			\
      edje_object_calc_force(obj);					\
   }
 
@@ -3766,6 +3822,7 @@ edje_edit_state_visible_set(Evas_Object *obj, const char *part, const char *stat
    //printf("Set state visible flag of part: %s state: %s to: %d\n", part, state, visible);
    if (visible) pd->visible = 1;
    else         pd->visible = 0;
+   _edje_collection_size_min_clean(ed->collection);
    edje_object_calc_force(obj);
 }
 
@@ -3789,6 +3846,7 @@ edje_edit_state_aspect_pref_set(Evas_Object *obj, const char *part, const char *
 
    //printf("SET ASPECT_PREF of state '%s' [to: %d]\n", state, pref);
    pd->aspect.prefer = pref;
+   _edje_collection_size_min_clean(ed->collection);
 }
 
 EAPI const char*
@@ -4124,10 +4182,10 @@ edje_edit_state_external_param_set(Evas_Object *obj, const char *part, const cha
    if (!found)
      external->external_params = eina_list_append(external->external_params, p);
 
-   _edje_external_parsed_params_free(rp->swallowed_object,
+   _edje_external_parsed_params_free(rp->typedata.swallow->swallowed_object,
 				     rp->param1.external_params);
    rp->param1.external_params = \
-			     _edje_external_params_parse(rp->swallowed_object,
+			     _edje_external_params_parse(rp->typedata.swallow->swallowed_object,
 							 external->external_params);
 
 
@@ -4215,6 +4273,7 @@ edje_edit_state_text_set(Evas_Object *obj, const char *part, const char *state,
    txt->text.text.str = (char *)eina_stringshare_add(text);
    txt->text.text.id = 0;
 
+   _edje_collection_size_min_clean(ed->collection);
    edje_object_calc_force(obj);
 }
 
@@ -4257,6 +4316,7 @@ edje_edit_state_text_size_set(Evas_Object *obj, const char *part, const char *st
 
    txt->text.size = size;
 
+   _edje_collection_size_min_clean(ed->collection);
    edje_object_calc_force(obj);
 }
 
@@ -4292,6 +4352,7 @@ edje_edit_state_text_size_set(Evas_Object *obj, const char *part, const char *st
                                                                         \
      txt = (Edje_Part_Description_Text *) pd;				\
      txt->text.Value = FROM_DOUBLE(v);					\
+     _edje_collection_size_min_clean(ed->collection);			\
      edje_object_calc_force(obj);					\
   }									\
 
@@ -4329,6 +4390,7 @@ FUNC_TEXT_DOUBLE(elipsis, elipsis);
 									\
      txt = (Edje_Part_Description_Text *) pd;				\
      txt->text.fit_##Value = fit ? 1 : 0;				\
+     _edje_collection_size_min_clean(ed->collection);			\
      edje_object_calc_force(obj);					\
   }
 
@@ -4551,6 +4613,7 @@ edje_edit_state_font_set(Evas_Object *obj, const char *part, const char *state,
    txt->text.font.str = (char *)eina_stringshare_add(font);
    txt->text.font.id = 0;
 
+   _edje_collection_size_min_clean(ed->collection);
    edje_object_calc_force(obj);
 }
 
@@ -4904,6 +4967,7 @@ edje_edit_state_image_set(Evas_Object *obj, const char *part, const char *state,
 
    if (id > -1) img->image.id = id;
 
+   _edje_collection_size_min_clean(ed->collection);
    edje_object_calc_force(obj);
 }
 
@@ -5059,6 +5123,7 @@ edje_edit_state_image_border_set(Evas_Object *obj, const char *part, const char
    if (t > -1) img->image.border.t = t;
    if (b > -1) img->image.border.b = b;
 
+   _edje_collection_size_min_clean(ed->collection);
    edje_object_calc_force(obj);
 }
 
@@ -5192,6 +5257,7 @@ edje_edit_program_add(Evas_Object *obj, const char *name)
    ed->collection->programs.nocmp = realloc(ed->collection->programs.nocmp,
 					    sizeof (Edje_Program*) * (ed->collection->programs.nocmp_count + 1));
    ed->collection->programs.nocmp[ed->collection->programs.nocmp_count++] = epr;
+   _edje_collection_programs_patterns_clean(ed->collection);
 
    //Init Edje_Program
    epr->id = ed->table_programs_size;
@@ -5302,6 +5368,7 @@ edje_edit_program_del(Evas_Object *obj, const char *prog)
      free(prt);
    EINA_LIST_FREE(epr->after, pa)
      free(pa);
+   free(epr->tween_lut);
    free(epr);
 
    ed->table_programs_size--;
@@ -7648,7 +7715,6 @@ _edje_edit_internal_save(Evas_Object *obj, int current_only)
      }
    else
      {
-	Eina_List *l;
 	Edje_Part_Collection *edc;
 	Edje_Part_Collection_Directory_Entry *ce;
         Eina_Iterator *it;
@@ -7671,7 +7737,7 @@ _edje_edit_internal_save(Evas_Object *obj, int current_only)
 	  }
 	eina_iterator_free(it);
 
-	EINA_LIST_FOREACH(ef->collection_cache, l, edc)
+	EINA_INLIST_FOREACH(ef->collection_cache, edc)
 	  {
 	     INF("** Writing cache Edje_Part_Collection* ed->collection "
 		   "[id: %d]", edc->id);
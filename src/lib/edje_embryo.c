@@ -674,11 +674,10 @@ _edje_embryo_fn_set_min_size(Embryo_Program *ep, Embryo_Cell *params)
    if (h < 0.0) h = 0.0;
    ed->collection->prop.min.w = w;
    ed->collection->prop.min.h = h;
+   _edje_collection_size_min_clean(ed->collection);
    ed->recalc_call = 1;
    ed->dirty = 1;
-#ifdef EDJE_CALC_CACHE
    ed->all_part_change = 1;
-#endif
    _edje_recalc(ed);
    return 0;
 }
@@ -702,11 +701,10 @@ _edje_embryo_fn_set_max_size(Embryo_Program *ep, Embryo_Cell *params)
    if (h < 0.0) h = 0.0;
    ed->collection->prop.max.w = w;
    ed->collection->prop.max.h = h;
+   _edje_collection_size_min_clean(ed->collection);
    ed->recalc_call = 1;
    ed->dirty = 1;
-#ifdef EDJE_CALC_CACHE
    ed->all_part_change = 1;
-#endif
    _edje_recalc(ed);
 
    return 0;
@@ -718,21 +716,13 @@ _edje_embryo_fn_stop_program(Embryo_Program *ep, Embryo_Cell *params)
 {
    Edje *ed;
    int program_id = 0;
-   Edje_Running_Program *runp;
-   Eina_List *l;
 
    CHKPARAM(1);
    ed = embryo_program_data_get(ep);
    program_id = params[1];
    if (program_id < 0) return 0;
 
-   ed->walking_actions = 1;
-
-   EINA_LIST_FOREACH(ed->actions, l, runp)
-     if (program_id == runp->program->id)
-       _edje_program_end(ed, runp);
-
-   ed->walking_actions = 0;
+   _edje_running_programs_end(ed, program_id);
 
    return 0;
 }
@@ -2199,9 +2189,7 @@ _edje_embryo_fn_set_state_val(Embryo_Program *ep, Embryo_Cell *params)
 	 break;
      }
 
-#ifdef EDJE_CALC_CACHE
    rp->invalidate = 1;
-#endif
    ed->dirty=1;
    return 0;
 }
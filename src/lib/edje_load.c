@@ -24,9 +24,37 @@ struct _Edje_Drag_Items
    } page;
 };
 
-#ifdef EDJE_PROGRAM_CACHE
-static Eina_Bool  _edje_collection_free_prog_cache_matches_free_cb(const Eina_Hash *hash, const void *key, void *data, void *fdata);
-#endif
+/* an edje_object_file_set_async() waiting for its groups to be preloaded,
+ * then for its turn in the idler */
+typedef struct _Edje_Async_Load Edje_Async_Load;
+struct _Edje_Async_Load
+{
+   Evas_Object *obj;
+   const char *file;
+   const char *group;
+   Eina_Hash *groups; /* the groups already asked for */
+   Eina_List *refs; /* Edje_Async_Ref, the groups preloaded so far */
+   int pending; /* preloads not reported yet */
+   Eina_Bool cancelled : 1;
+};
+
+/* a preloaded group held until the file set, the collection cache could
+ * otherwise drop it again when the object uses more groups than it keeps */
+typedef struct _Edje_Async_Ref Edje_Async_Ref;
+struct _Edje_Async_Ref
+{
+   Edje_File *edf;
+   Edje_Part_Collection *edc;
+};
+
+static Eina_List *_edje_async_loads = NULL;
+static Ecore_Idler *_edje_async_idler = NULL;
+static double _edje_async_budget = 0.004;
+static Eina_Bool _edje_async_visible_first = EINA_FALSE;
+
+static void _edje_object_file_async_cancel(Evas_Object *obj);
+static void _edje_async_obj_del_cb(void *data, Evas *e, Evas_Object *obj, void *event_info);
+
 static void _edje_object_pack_item_hints_set(Evas_Object *obj, Edje_Pack_Element *it);
 static void _cb_signal_repeat(void *data, Evas_Object *obj, const char *signal, const char *source);
 
@@ -45,11 +73,241 @@ edje_object_file_set(Evas_Object *obj, const char *file, const char *group)
    ed = _edje_fetch(obj);
    if (!ed)
      return EINA_FALSE;
+   if (_edje_async_loads) _edje_object_file_async_cancel(obj);
    ret = ed->api->file_set(obj, file, group);
    _edje_object_orientation_inform(obj);
    return ret;
 }
 
+static void
+_edje_async_load_free(Edje_Async_Load *al)
+{
+   Edje_Async_Ref *ar;
+
+   EINA_LIST_FREE(al->refs, ar)
+     {
+	_edje_cache_coll_unref(ar->edf, ar->edc);
+	_edje_cache_file_unref(ar->edf);
+	free(ar);
+     }
+   eina_stringshare_del(al->file);
+   eina_stringshare_del(al->group);
+   eina_hash_free(al->groups);
+   free(al);
+}
+
+/* the preloads still running report to al, so it only goes away with
+ * the last of them */
+static void
+_edje_async_load_drop(Edje_Async_Load *al)
+{
+   _edje_async_loads = eina_list_remove(_edje_async_loads, al);
+   evas_object_event_callback_del_full(al->obj, EVAS_CALLBACK_DEL,
+				       _edje_async_obj_del_cb, al);
+   al->cancelled = EINA_TRUE;
+   if (!al->pending) _edje_async_load_free(al);
+}
+
+static void
+_edje_async_obj_del_cb(void *data, Evas *e __UNUSED__, Evas_Object *obj __UNUSED__, void *event_info __UNUSED__)
+{
+   _edje_async_load_drop(data);
+}
+
+static void
+_edje_object_file_async_cancel(Evas_Object *obj)
+{
+   Edje_Async_Load *al;
+   Eina_List *l;
+
+   EINA_LIST_FOREACH(_edje_async_loads, l, al)
+     if (al->obj == obj)
+       {
+	  _edje_async_load_drop(al);
+	  return;
+       }
+}
+
+static Edje_Async_Load *
+_edje_async_load_next(void)
+{
+   Edje_Async_Load *al, *first = NULL;
+   Eina_List *l;
+
+   EINA_LIST_FOREACH(_edje_async_loads, l, al)
+     {
+	if (al->pending) continue;
+	if ((!_edje_async_visible_first) || (evas_object_visible_get(al->obj)))
+	  return al;
+	if (!first) first = al;
+     }
+   return first;
+}
+
+static Eina_Bool
+_edje_async_idler_cb(void *data __UNUSED__)
+{
+   Edje_Async_Load *al;
+   Eina_Bool ret;
+   double start;
+
+   start = ecore_time_get();
+   while ((al = _edje_async_load_next()))
+     {
+	_edje_async_loads = eina_list_remove(_edje_async_loads, al);
+	evas_object_event_callback_del_full(al->obj, EVAS_CALLBACK_DEL,
+					    _edje_async_obj_del_cb, al);
+
+	/* the groups are all held by al, so this is left with creating
+	 * the objects, they are let go of after */
+	ret = edje_object_file_set(al->obj, al->file, al->group);
+	evas_object_smart_callback_call(al->obj, ret ? "load,done" : "load,error", NULL);
+	_edje_async_load_free(al);
+
+	if (ecore_time_get() - start >= _edje_async_budget) break;
+     }
+
+   if (_edje_async_load_next()) return ECORE_CALLBACK_RENEW;
+   _edje_async_idler = NULL;
+   return ECORE_CALLBACK_CANCEL;
+}
+
+static void _edje_async_group_preload(Edje_Async_Load *al, const char *group);
+
+static void
+_edje_async_preloaded_cb(void *data, const char *file, const char *group, Eina_Bool success)
+{
+   Edje_Async_Load *al = data;
+   Edje_Part_Collection *edc = NULL;
+   Edje_Async_Ref *ar;
+   Edje_File *edf;
+   int error_ret = EDJE_LOAD_ERROR_NONE;
+   unsigned int i, j;
+
+   al->pending--;
+   if (al->cancelled)
+     {
+	if (!al->pending) _edje_async_load_free(al);
+	return;
+     }
+
+   if (success)
+     {
+	/* the nested groups are preloaded as well, the file set would
+	 * otherwise decode them on the main loop */
+	edf = _edje_cache_file_coll_open(file, group, &error_ret, &edc, NULL);
+	if (edc)
+	  {
+	     for (i = 0; i < edc->parts_count; ++i)
+	       {
+		  Edje_Part *ep = edc->parts[i];
+
+		  if ((ep->type == EDJE_PART_TYPE_GROUP) && (ep->source))
+		    _edje_async_group_preload(al, ep->source);
+		  else if ((ep->type == EDJE_PART_TYPE_BOX) ||
+			   (ep->type == EDJE_PART_TYPE_TABLE))
+		    for (j = 0; j < ep->items_count; ++j)
+		      if (ep->items[j]->source)
+			_edje_async_group_preload(al, ep->items[j]->source);
+	       }
+
+	     ar = malloc(sizeof (Edje_Async_Ref));
+	     if (ar)
+	       {
+		  ar->edf = edf;
+		  ar->edc = edc;
+		  al->refs = eina_list_append(al->refs, ar);
+		  edf = NULL;
+	       }
+	     else
+	       _edje_cache_coll_unref(edf, edc);
+	  }
+	if (edf) _edje_cache_file_unref(edf);
+     }
+
+   if ((!al->pending) && (!_edje_async_idler))
+     _edje_async_idler = ecore_idler_add(_edje_async_idler_cb, NULL);
+}
+
+static void
+_edje_async_group_preload(Edje_Async_Load *al, const char *group)
+{
+   if (eina_hash_find(al->groups, group)) return;
+   eina_hash_add(al->groups, group, al);
+
+   /* counted first, the callback may run before the call returns */
+   al->pending++;
+   if (!edje_file_collection_preload(al->file, group, _edje_async_preloaded_cb, al))
+     al->pending--;
+}
+
+EAPI Eina_Bool
+edje_object_file_set_async(Evas_Object *obj, const char *file, const char *group)
+{
+   Edje_Async_Load *al;
+   Edje *ed;
+
+   ed = _edje_fetch(obj);
+   if (!ed)
+     return EINA_FALSE;
+   if (_edje_async_loads) _edje_object_file_async_cancel(obj);
+
+   al = calloc(1, sizeof (Edje_Async_Load));
+   if (!al) return EINA_FALSE;
+   al->obj = obj;
+   al->file = eina_stringshare_add(file ? file : "");
+   al->group = eina_stringshare_add(group ? group : "");
+   al->groups = eina_hash_string_small_new(NULL);
+
+   _edje_async_loads = eina_list_append(_edje_async_loads, al);
+   evas_object_event_callback_add(obj, EVAS_CALLBACK_DEL,
+				  _edje_async_obj_del_cb, al);
+
+   /* a group that cannot be preloaded still goes through the idler, so
+    * the error is reported the same way */
+   _edje_async_group_preload(al, al->group);
+   if ((!al->pending) && (!_edje_async_idler))
+     _edje_async_idler = ecore_idler_add(_edje_async_idler_cb, NULL);
+   return EINA_TRUE;
+}
+
+EAPI void
+edje_file_async_budget_set(double t)
+{
+   if (t < 0.0) t = 0.0;
+   _edje_async_budget = t;
+}
+
+EAPI double
+edje_file_async_budget_get(void)
+{
+   return _edje_async_budget;
+}
+
+EAPI void
+edje_file_async_visible_first_set(Eina_Bool visible_first)
+{
+   _edje_async_visible_first = !!visible_first;
+}
+
+EAPI Eina_Bool
+edje_file_async_visible_first_get(void)
+{
+   return _edje_async_visible_first;
+}
+
+void
+_edje_object_file_async_shutdown(void)
+{
+   if (_edje_async_idler)
+     {
+	ecore_idler_del(_edje_async_idler);
+	_edje_async_idler = NULL;
+     }
+   while (_edje_async_loads)
+     _edje_async_load_drop(eina_list_data_get(_edje_async_loads));
+}
+
 EAPI void
 edje_object_file_get(const Evas_Object *obj, const char **file, const char **group)
 {
@@ -231,25 +489,39 @@ edje_file_data_get(const char *file, const char *key)
 void
 _edje_programs_patterns_clean(Edje *ed)
 {
-   _edje_signals_sources_patterns_clean(&ed->patterns.programs);
-
    eina_rbtree_delete(ed->patterns.programs.exact_match,
 		      EINA_RBTREE_FREE_CB(edje_match_signal_source_free),
 		      NULL);
    ed->patterns.programs.exact_match = NULL;
+}
 
-   free(ed->patterns.programs.u.programs.globing);
-   ed->patterns.programs.u.programs.globing = NULL;
+void
+_edje_collection_programs_patterns_clean(Edje_Part_Collection *edc)
+{
+   edje_match_dfa_free(edc->patterns.signals);
+   edje_match_dfa_free(edc->patterns.sources);
+   edc->patterns.signals = NULL;
+   edc->patterns.sources = NULL;
+
+   free(edc->patterns.globing);
+   edc->patterns.globing = NULL;
+   edc->patterns.globing_count = 0;
+   edc->patterns.timelines = EINA_FALSE;
+   /* every Edje of this group rebuilds its exact matches on next emit */
+   edc->patterns.generation++;
+
+   _edje_collection_program_cache_clean(edc);
 }
 
 void
 _edje_programs_patterns_init(Edje *ed)
 {
    Edje_Signals_Sources_Patterns *ssp = &ed->patterns.programs;
-   Edje_Program **all;
-   unsigned int i, j;
+   Edje_Part_Collection *edc = ed->collection;
+   unsigned int i;
 
-   if (ssp->signals_patterns)
+   ed->patterns.programs_generation = edc->patterns.generation;
+   if (ssp->exact_match)
      return;
 
    if (getenv("EDJE_DUMP_PROGRAMS"))
@@ -266,14 +538,34 @@ _edje_programs_patterns_init(Edje *ed)
        EDJE_DUMP_PROGRAM(nocmp);
      }
 
-   edje_match_program_hash_build(ed->collection->programs.strcmp,
-				 ed->collection->programs.strcmp_count,
+   edje_match_program_hash_build(edc->programs.strcmp,
+				 edc->programs.strcmp_count,
 				 &ssp->exact_match);
 
-   j = ed->collection->programs.strncmp_count
-     + ed->collection->programs.strrncmp_count
-     + ed->collection->programs.fnmatch_count
-     + ed->collection->programs.nocmp_count;
+   if (!edc->patterns.timelines)
+     {
+	_edje_programs_timelines_init(ed);
+	edc->patterns.timelines = EINA_TRUE;
+     }
+
+   _edje_collection_patterns_build(edc);
+}
+
+/* the glob matchers are built once for the whole group, this only reads
+ * the collection and may run in a preload thread */
+void
+_edje_collection_patterns_build(Edje_Part_Collection *edc)
+{
+   Edje_Program **all;
+   unsigned int i, j;
+
+   if (edc->patterns.globing)
+     return;
+
+   j = edc->programs.strncmp_count
+     + edc->programs.strrncmp_count
+     + edc->programs.fnmatch_count
+     + edc->programs.nocmp_count;
    if (j == 0) return ;
 
    all = malloc(sizeof (Edje_Program *) * j);
@@ -281,20 +573,20 @@ _edje_programs_patterns_init(Edje *ed)
    j = 0;
 
    /* FIXME: Build specialized data type for each case */
-#define EDJE_LOAD_PROGRAMS_ADD(Array, Ed, It, Git, All)			\
-   for (It = 0; It < Ed->collection->programs.Array##_count; ++It, ++Git) \
-     All[Git] = Ed->collection->programs.Array[It];
+#define EDJE_LOAD_PROGRAMS_ADD(Array, Edc, It, Git, All)			\
+   for (It = 0; It < Edc->programs.Array##_count; ++It, ++Git)		\
+     All[Git] = Edc->programs.Array[It];
 
-   EDJE_LOAD_PROGRAMS_ADD(fnmatch, ed, i, j, all);
-   EDJE_LOAD_PROGRAMS_ADD(strncmp, ed, i, j, all);
-   EDJE_LOAD_PROGRAMS_ADD(strrncmp, ed, i, j, all);
+   EDJE_LOAD_PROGRAMS_ADD(fnmatch, edc, i, j, all);
+   EDJE_LOAD_PROGRAMS_ADD(strncmp, edc, i, j, all);
+   EDJE_LOAD_PROGRAMS_ADD(strrncmp, edc, i, j, all);
    /* FIXME: Do a special pass for that one */
-   EDJE_LOAD_PROGRAMS_ADD(nocmp, ed, i, j, all);
+   EDJE_LOAD_PROGRAMS_ADD(nocmp, edc, i, j, all);
 
-   ssp->u.programs.globing = all;
-   ssp->u.programs.count = j;
-   ssp->signals_patterns = edje_match_programs_signal_init(all, j);
-   ssp->sources_patterns = edje_match_programs_source_init(all, j);
+   edc->patterns.globing = all;
+   edc->patterns.globing_count = j;
+   edc->patterns.signals = edje_match_programs_signal_dfa_new(all, j);
+   edc->patterns.sources = edje_match_programs_source_dfa_new(all, j);
 }
 
 int
@@ -319,11 +611,8 @@ _edje_object_file_set_internal(Evas_Object *obj, const char *file, const char *g
        (ed->group) && (!strcmp(group, ed->group)) &&
        ed->file)
      {
-        struct stat st;
-
-        if (stat(file, &st) != 0)
-          return 1;
-        if (st.st_mtime == ed->file->mtime)
+        /* nothing to do unless the file changed on disk */
+        if (_edje_cache_file_check(ed->file) != 0)
           return 1;
      }
 
@@ -435,9 +724,19 @@ _edje_object_file_set_internal(Evas_Object *obj, const char *file, const char *g
 		       rp->drag->step.y = FROM_INT(ep->dragable.step_y);
 		    }
 
+		  rp->part = ep;
+		  if (!_edje_real_part_typedata_new(rp))
+		    {
+		       ed->load_error = EDJE_LOAD_ERROR_RESOURCE_ALLOCATION_FAILED;
+		       free(rp->drag);
+		       eina_mempool_free(_edje_real_part_mp, rp);
+                       evas_event_thaw(tev);
+                       evas_event_thaw_eval(tev);
+                       return 0;
+		    }
+
 		  rp->edje = ed;
 		  _edje_ref(rp->edje);
-		  rp->part = ep;
 		  parts = eina_list_append(parts, rp);
 		  rp->param1.description = 
                     _edje_part_description_find(ed, rp, "default", 0.0);
@@ -479,7 +778,7 @@ _edje_object_file_set_internal(Evas_Object *obj, const char *file, const char *g
 		     case EDJE_PART_TYPE_BOX:
                         sources = eina_list_append(sources, rp);
 			rp->object = evas_object_box_add(ed->base.evas);
-                        rp->anim = _edje_box_layout_anim_new(rp->object);
+                        rp->typedata.container->anim = _edje_box_layout_anim_new(rp->object);
 			break;
 		     case EDJE_PART_TYPE_TABLE:
                         sources = eina_list_append(sources, rp);
@@ -582,11 +881,6 @@ _edje_object_file_set_internal(Evas_Object *obj, const char *file, const char *g
 			      rp->events_to = NULL;
 			 }
 
-		       rp->swallow_params.min.w = 0;
-		       rp->swallow_params.min.h = 0;
-		       rp->swallow_params.max.w = -1;
-		       rp->swallow_params.max.h = -1;
-
 		       if (rp->part->type == EDJE_PART_TYPE_TEXT
 			   || rp->part->type == EDJE_PART_TYPE_TEXTBLOCK)
 			 {
@@ -601,9 +895,9 @@ _edje_object_file_set_internal(Evas_Object *obj, const char *file, const char *g
 			      }
 
 			    if (text->text.id_source >= 0)
-			      rp->text.source = ed->table_parts[text->text.id_source % ed->table_parts_size];
+			      rp->typedata.text->source = ed->table_parts[text->text.id_source % ed->table_parts_size];
 			    if (text->text.id_text_source >= 0)
-			      rp->text.text_source = ed->table_parts[text->text.id_text_source % ed->table_parts_size];
+			      rp->typedata.text->text_source = ed->table_parts[text->text.id_text_source % ed->table_parts_size];
 			    if (rp->part->entry_mode > EDJE_ENTRY_EDIT_MODE_NONE)
 			      {
 				 _edje_entry_real_part_init(rp);
@@ -663,9 +957,7 @@ _edje_object_file_set_internal(Evas_Object *obj, const char *file, const char *g
 	       }
              ed->recalc_call = 1;
 	     ed->dirty = 1;
-#ifdef EDJE_CALC_CACHE
 	     ed->all_part_change = 1;
-#endif
 	     if ((evas_object_clipees_get(ed->base.clipper)) &&
 		 (evas_object_visible_get(obj)))
 	       evas_object_show(ed->base.clipper);
@@ -832,7 +1124,7 @@ _edje_object_file_set_internal(Evas_Object *obj, const char *file, const char *g
 			      }
                             _edje_subobj_register(ed, child_obj);
 			    evas_object_show(child_obj);
-			    rp->items = eina_list_append(rp->items, child_obj);
+			    rp->typedata.container->items = eina_list_append(rp->typedata.container->items, child_obj);
 
 			    if (item_count > 0)
 			      {
@@ -1080,6 +1372,53 @@ _edje_object_collect(Edje *ed)
    return collect;
 }
 
+/* Allocate the part data that only make sense for some part types, so
+ * that a rectangle or an image do not pay for text caches, swallow hints
+ * or box items. */
+Eina_Bool
+_edje_real_part_typedata_new(Edje_Real_Part *rp)
+{
+   switch (rp->part->type)
+     {
+      case EDJE_PART_TYPE_TEXT:
+      case EDJE_PART_TYPE_TEXTBLOCK:
+         rp->type = EDJE_RP_TYPE_TEXT;
+         rp->typedata.text = calloc(1, sizeof (Edje_Real_Part_Text));
+         return !!rp->typedata.text;
+      case EDJE_PART_TYPE_BOX:
+      case EDJE_PART_TYPE_TABLE:
+         rp->type = EDJE_RP_TYPE_CONTAINER;
+         rp->typedata.container = calloc(1, sizeof (Edje_Real_Part_Container));
+         return !!rp->typedata.container;
+      case EDJE_PART_TYPE_SWALLOW:
+      case EDJE_PART_TYPE_GROUP:
+      case EDJE_PART_TYPE_EXTERNAL:
+         rp->type = EDJE_RP_TYPE_SWALLOW;
+         rp->typedata.swallow = calloc(1, sizeof (Edje_Real_Part_Swallow));
+         if (!rp->typedata.swallow) return EINA_FALSE;
+         rp->typedata.swallow->swallow_params.max.w = -1;
+         rp->typedata.swallow->swallow_params.max.h = -1;
+         return EINA_TRUE;
+      default:
+         rp->type = EDJE_RP_TYPE_NONE;
+         return EINA_TRUE;
+     }
+}
+
+void
+_edje_real_part_typedata_free(Edje_Real_Part *rp)
+{
+   switch (rp->type)
+     {
+      case EDJE_RP_TYPE_TEXT: free(rp->typedata.text); break;
+      case EDJE_RP_TYPE_CONTAINER: free(rp->typedata.container); break;
+      case EDJE_RP_TYPE_SWALLOW: free(rp->typedata.swallow); break;
+      default: break;
+     }
+   rp->typedata.text = NULL;
+   rp->type = EDJE_RP_TYPE_NONE;
+}
+
 void
 _edje_file_del(Edje *ed)
 {
@@ -1137,38 +1476,42 @@ _edje_file_del(Edje *ed)
 		  _edje_callbacks_focus_del(rp->object, ed);
 		  evas_object_del(rp->object);
 	       }
-	     if (rp->swallowed_object)
+	     if ((rp->type == EDJE_RP_TYPE_SWALLOW) &&
+		 (rp->typedata.swallow->swallowed_object))
 	       {
                   /* Objects swallowed by the app do not get deleted,
                    but those internally swallowed (GROUP type) do. */
 		  switch (rp->part->type)
 		    {
 		     case EDJE_PART_TYPE_EXTERNAL:
-			_edje_external_parsed_params_free(rp->swallowed_object, rp->param1.external_params);
+			_edje_external_parsed_params_free(rp->typedata.swallow->swallowed_object, rp->param1.external_params);
 			if (rp->param2)
-			  _edje_external_parsed_params_free(rp->swallowed_object, rp->param2->external_params);
+			  _edje_external_parsed_params_free(rp->typedata.swallow->swallowed_object, rp->param2->external_params);
 		     case EDJE_PART_TYPE_GROUP:
-			evas_object_del(rp->swallowed_object);
+			evas_object_del(rp->typedata.swallow->swallowed_object);
 		     default:
 			break;
 		    }
                   _edje_real_part_swallow_clear(rp);
-		  rp->swallowed_object = NULL;
+		  rp->typedata.swallow->swallowed_object = NULL;
 	       }
-	     if (rp->items)
+	     if (rp->type == EDJE_RP_TYPE_CONTAINER)
 	       {
 		  /* evas_box/table handles deletion of objects */
-		  rp->items = eina_list_free(rp->items);
+		  rp->typedata.container->items = eina_list_free(rp->typedata.container->items);
+		  if (rp->typedata.container->anim)
+		    {
+		       _edje_box_layout_free_data(rp->typedata.container->anim);
+		       rp->typedata.container->anim = NULL;
+		    }
+	       }
+	     if (rp->type == EDJE_RP_TYPE_TEXT)
+	       {
+		  if (rp->typedata.text->text) eina_stringshare_del(rp->typedata.text->text);
+		  if (rp->typedata.text->font) eina_stringshare_del(rp->typedata.text->font);
+		  if (rp->typedata.text->cache.in_str) eina_stringshare_del(rp->typedata.text->cache.in_str);
+		  if (rp->typedata.text->cache.out_str) eina_stringshare_del(rp->typedata.text->cache.out_str);
 	       }
-             if (rp->anim)
-               {
-                  _edje_box_layout_free_data(rp->anim);
-                  rp->anim = NULL;
-               }
-	     if (rp->text.text) eina_stringshare_del(rp->text.text);
-	     if (rp->text.font) eina_stringshare_del(rp->text.font);
-	     if (rp->text.cache.in_str) eina_stringshare_del(rp->text.cache.in_str);
-	     if (rp->text.cache.out_str) eina_stringshare_del(rp->text.cache.out_str);
 
 	     if (rp->custom)
                {
@@ -1182,14 +1525,18 @@ _edje_file_del(Edje *ed)
 
 	     /* Cleanup optional part. */
 	     free(rp->drag);
+	     _edje_real_part_typedata_free(rp);
 	     free(rp->param1.set);
+	     _edje_calc_cache_state_clean(ed, &rp->param1);
 
 	     if (rp->param2)
 	       free(rp->param2->set);
+	     _edje_calc_cache_state_clean(ed, rp->param2);
 	     eina_mempool_free(_edje_real_part_state_mp, rp->param2);
 
 	     if (rp->custom)
 	       free(rp->custom->set);
+	     _edje_calc_cache_state_clean(ed, rp->custom);
 	     eina_mempool_free(_edje_real_part_state_mp, rp->custom);
 
 	     _edje_unref(rp->edje);
@@ -1221,17 +1568,7 @@ _edje_file_del(Edje *ed)
         _edje_cache_file_unref(ed->file);
 	ed->file = NULL;
      }
-   if (ed->actions)
-     {
-	Edje_Running_Program *runp;
-
-	EINA_LIST_FREE(ed->actions, runp)
-	  {
-	     _edje_anim_count--;
-	     free(runp);
-	  }
-     }
-   _edje_animators = eina_list_remove(_edje_animators, ed);
+   _edje_running_programs_free(ed);
    if (ed->pending_actions)
      {
 	Edje_Pending_Program *pp;
@@ -1370,6 +1707,7 @@ _edje_program_free(Edje_Program *pr, Eina_Bool free_strings)
      free(prt);
    EINA_LIST_FREE(pr->after, pa)
      free(pa);
+   free(pr->tween_lut);
    free(pr);
 }
 
@@ -1391,6 +1729,11 @@ _edje_collection_free(Edje_File *edf, Edje_Part_Collection *ec, Edje_Part_Collec
    EDJE_LOAD_PROGRAM_FREE(strrncmp, ec, i, edf->free_strings);
    EDJE_LOAD_PROGRAM_FREE(nocmp, ec, i, edf->free_strings);
 
+   _edje_collection_part_names_clean(ec);
+   _edje_collection_dependents_clean(ec);
+   _edje_collection_size_min_clean(ec);
+   _edje_collection_programs_patterns_clean(ec);
+
    for (i = 0; i < ec->parts_count; ++i)
      {
 	Edje_Part *ep;
@@ -1411,6 +1754,7 @@ _edje_collection_free(Edje_File *edf, Edje_Part_Collection *ec, Edje_Part_Collec
         /* Alloc for RTL objects in edje_calc.c:_edje_part_description_find() */
         if(ep->other.desc_rtl)
           free(ep->other.desc_rtl);
+	free(ep->other_index);
 
 	free(ep->items);
 // technically need this - but we ASSUME we use "one_big" so everything gets
@@ -1433,16 +1777,6 @@ _edje_collection_free(Edje_File *edf, Edje_Part_Collection *ec, Edje_Part_Collec
 
 	eina_hash_free(ec->data);
      }
-#ifdef EDJE_PROGRAM_CACHE
-   if (ec->prog_cache.no_matches) eina_hash_free(ec->prog_cache.no_matches);
-   if (ec->prog_cache.matches)
-     {
-	eina_hash_foreach(ec->prog_cache.matches,
-			  _edje_collection_free_prog_cache_matches_free_cb,
-			  NULL);
-	eina_hash_free(ec->prog_cache.matches);
-     }
-#endif
    if (ec->script) embryo_program_free(ec->script);
    _edje_lua2_script_unload(ec);
 
@@ -1551,18 +1885,6 @@ _edje_collection_free_part_description_free(int type,
      }
 }
 
-#ifdef EDJE_PROGRAM_CACHE
-static Eina_Bool
-_edje_collection_free_prog_cache_matches_free_cb(const Eina_Hash *hash, const void *key, void *data, void *fdata)
-{
-   eina_list_free((Eina_List *)data);
-   return EINA_TRUE;
-   key = NULL;
-   hash = NULL;
-   fdata = NULL;
-}
-#endif
-
 static void
 _edje_object_pack_item_hints_set(Evas_Object *obj, Edje_Pack_Element *it)
 {
@@ -1728,10 +2050,12 @@ _cb_signal_repeat(void *data, Evas_Object *obj, const char *sig, const char *sou
           }
      }
    
-   emsg.sig = sig;
-   emsg.src = alias ? alias : new_src;
+   if (!ed_parent) return;
+   emsg.sig = eina_stringshare_add(sig);
+   emsg.src = eina_stringshare_add(alias ? alias : new_src);
    emsg.data = NULL;
-   if (ed_parent)
-     _edje_message_send(ed_parent, EDJE_QUEUE_SCRIPT, 
-                        EDJE_MESSAGE_SIGNAL, 0, &emsg);
+   _edje_message_send(ed_parent, EDJE_QUEUE_SCRIPT, 
+                      EDJE_MESSAGE_SIGNAL, 0, &emsg);
+   eina_stringshare_del(emsg.sig);
+   eina_stringshare_del(emsg.src);
 }
@@ -4534,13 +4534,7 @@ _edje_lua_group_fn_program_stop(lua_State *L)
    Edje_Program *pr =
       _edje_lua_program_get_byname(obj->eo, luaL_checkstring(L, 2));
    int program_id = pr->id;
-   Edje_Running_Program *runp;
-   Eina_List *l;
-   obj->ed->walking_actions = 1;
-   EINA_LIST_FOREACH(obj->ed->actions, l, runp)
-      if (program_id == runp->program->id)
-      _edje_program_end(obj->ed, runp);
-   obj->ed->walking_actions = 0;
+   _edje_running_programs_end(obj->ed, program_id);
    return 0;
 }
 
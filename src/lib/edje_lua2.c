@@ -3848,7 +3848,8 @@ _edje_lua2_script_init(Edje *ed)                                  // Stack usage
    static Edje_Lua_Alloc ela = { MAX_LUA_MEM, 0 };
    const luaL_Reg *l;
    char buf[256];
-   void *data;
+   const void *data;
+   void *copy;
    int size;
    lua_State *L;
 
@@ -3918,7 +3919,7 @@ _edje_lua2_script_init(Edje *ed)                                  // Stack usage
    _elua_table_ptr_set(L, _elua_key, ed);                         // Stack usage [-2, +2, e]
 
    snprintf(buf, sizeof(buf), "edje/scripts/lua/%i", ed->collection->id);
-   data = eet_read(ed->file->ef, buf, &size);
+   data = _edje_file_data_get(ed->file, buf, &size, &copy);
 
    if (data)
      {
@@ -3936,7 +3937,7 @@ _edje_lua2_script_init(Edje *ed)                                  // Stack usage
                ERR("Lua load memory allocation error: %s",
                    lua_tostring(L, -1));                          // Stack usage [-0, +0, m]
           }
-        free(data);
+        free(copy);
         /* This is not needed, pcalls don't longjmp(), that's why they are protected.
         if (setjmp(panic_jmp) == 1)
           {
@@ -3982,7 +3983,7 @@ _edje_lua2_script_shutdown(Edje *ed)
 }
 
 void
-_edje_lua2_script_load(Edje_Part_Collection *edc __UNUSED__, void *data __UNUSED__, int size __UNUSED__)  // Stack usage [-16, +20, em]
+_edje_lua2_script_load(Edje_Part_Collection *edc __UNUSED__, const void *data __UNUSED__, int size __UNUSED__)  // Stack usage [-16, +20, em]
 {
 #ifndef RASTER_FORGOT_WHY
    _elua_init();  // Stack usage [-16, +20, em]
@@ -128,6 +128,7 @@ _edje_shutdown_core(void)
 {
    if (_edje_users > 0) return;
 
+   _edje_object_file_async_shutdown();
    _edje_file_cache_shutdown();
    _edje_color_class_members_free();
    _edje_color_class_hash_free();
@@ -207,7 +208,6 @@ _class_member_free(const Eina_Hash *hash __UNUSED__,
 void
 _edje_del(Edje *ed)
 {
-   Edje_Running_Program *runp;
    Edje_Pending_Program *pp;
    Edje_Signal_Callback *escb;
    Edje_Color_Class *cc;
@@ -227,12 +227,7 @@ _edje_del(Edje *ed)
    if (ed->parent) eina_stringshare_del(ed->parent);
    ed->path = NULL;
    ed->group = NULL;
-   if ((ed->actions) || (ed->pending_actions))
-     {
-	_edje_animators = eina_list_remove(_edje_animators, ed);
-     }
-   EINA_LIST_FREE(ed->actions, runp)
-     free(runp);
+   _edje_running_programs_free(ed);
    EINA_LIST_FREE(ed->pending_actions, pp)
      free(pp);
    EINA_LIST_FREE(ed->callbacks, escb)
@@ -314,84 +314,9 @@ _edje_match_patterns_exec_init_states(Edje_States       *states,
      return r;                                                  \
   }
 
-#define EDJE_MATCH_INIT_ARRAY(Func, Type, Source, Show)		\
-  Edje_Patterns*                                                \
-  Func(Type * const *lst, unsigned int count)			\
-  {                                                             \
-     Edje_Patterns      *r;                                     \
-     size_t              i;                                     \
-                                                                \
-     if (!lst || count == 0)					\
-       return NULL;                                             \
-                                                                \
-     r = malloc(sizeof (Edje_Patterns) +                        \
-                count						\
-                * sizeof(*r->finals)                            \
-                * sizeof(*r->patterns));                        \
-     if (!r) return NULL;                                       \
-                                                                \
-     r->ref = 1;						\
-     r->delete_me = 0;						\
-     r->patterns_size = count;					\
-     r->max_length = 0;                                         \
-     r->patterns = (const char **) r->finals + r->patterns_size + 1;    \
-                                                                \
-     for (i = 0; i < count; ++i)				\
-       {                                                        \
-          const char    *str;                                   \
-          size_t         j;                                     \
-          int            special = 0;                           \
-                                                                \
-          if (!lst[i])						\
-            {                                                   \
-               free(r);                                         \
-               return NULL;                                     \
-            }                                                   \
-                                                                \
-          str = lst[i]->Source;					\
-          if (!str) str = "";                                   \
-          r->patterns[i] = str;                                 \
-                                                                \
-          if (Show)                                             \
-            INF("%lu [%s]", (unsigned long)i, str);	        \
-                                                                \
-          r->finals[i] = 0;                                     \
-          for (j = 0; str[j]; ++j)                              \
-            if (str[j] != '*')                                  \
-              {                                                 \
-                 r->finals[i] = j + 1;                          \
-                 special++;                                     \
-              }                                                 \
-          j += special ? special + 1 : 0;                       \
-                                                                \
-          if (j > r->max_length)                                \
-            r->max_length = j;                                  \
-       }                                                        \
-                                                                \
-     if (!_edje_match_states_alloc(r, 2))                       \
-       {                                                        \
-          free(r);                                              \
-          return NULL;                                          \
-       }                                                        \
-                                                                \
-     return r;                                                  \
-  }
-
 EDJE_MATCH_INIT_LIST(edje_match_collection_dir_init,
 		     Edje_Part_Collection_Directory_Entry,
 		     entry, 0);
-EDJE_MATCH_INIT_ARRAY(edje_match_programs_signal_init,
-		     Edje_Program,
-		     signal, 0);
-EDJE_MATCH_INIT_ARRAY(edje_match_programs_source_init,
-		      Edje_Program,
-		      source, 0);
-EDJE_MATCH_INIT_LIST(edje_match_callback_signal_init,
-		     Edje_Signal_Callback,
-		     signal, 0);
-EDJE_MATCH_INIT_LIST(edje_match_callback_source_init,
-		     Edje_Signal_Callback,
-		     source, 0);
 
 static Eina_Bool
 _edje_match_collection_dir_exec_finals(const size_t      *finals,
@@ -407,108 +332,6 @@ _edje_match_collection_dir_exec_finals(const size_t      *finals,
    return EINA_FALSE;
 }
 
-static Eina_Bool
-edje_match_programs_exec_check_finals(const size_t      *signal_finals,
-                                      const size_t      *source_finals,
-                                      const Edje_States *signal_states,
-                                      const Edje_States *source_states,
-                                      Edje_Program     **programs,
-                                      Eina_Bool (*func)(Edje_Program *pr, void *data),
-                                      void              *data,
-                                      Eina_Bool          prop __UNUSED__)
-{
-   size_t       i;
-   size_t       j;
-
-   /* when not enought memory, they could be NULL */
-   if (!signal_finals || !source_finals) return EINA_TRUE;
-
-   for (i = 0; i < signal_states->size; ++i)
-     {
-        if (signal_states->states[i].pos >= signal_finals[signal_states->states[i].idx])
-          {
-             for (j = 0; j < source_states->size; ++j)
-               {
-                  if (signal_states->states[i].idx == source_states->states[j].idx
-                      && source_states->states[j].pos >= source_finals[source_states->states[j].idx])
-                    {
-                       Edje_Program  *pr;
-
-                       pr = programs[signal_states->states[i].idx];
-                       if (pr)
-                         {
-                            if (func(pr, data))
-                               return EINA_FALSE;
-                         }
-                    }
-               }
-          }
-     }
-
-   return EINA_TRUE;
-}
-
-static int
-edje_match_callback_exec_check_finals(const Edje_Patterns *signal_ppat,
-                                      const Edje_Patterns *source_ppat,
-                                      const size_t      *signal_finals,
-                                      const size_t      *source_finals,
-                                      const Edje_States *signal_states,
-                                      const Edje_States *source_states,
-                                      const char        *sig,
-                                      const char        *source,
-                                      Eina_List         *callbacks,
-                                      Edje              *ed,
-                                      Eina_Bool          prop
-                                     )
-{
-   Edje_Signal_Callback *escb;
-   Eina_Array   run;
-   size_t       i;
-   size_t       j;
-   int          r = 1;
-
-   eina_array_step_set(&run, sizeof (Eina_Array), 4);
-
-   for (i = 0; i < signal_states->size; ++i)
-     {
-        if (signal_states->states[i].pos >= signal_finals[signal_states->states[i].idx])
-          {
-             for (j = 0; j < source_states->size; ++j)
-               {
-                  if (signal_states->states[i].idx == source_states->states[j].idx
-                      && source_states->states[j].pos >= source_finals[source_states->states[j].idx])
-                    {
-                       escb = eina_list_nth(callbacks, signal_states->states[i].idx);
-                       if (escb)
-                         {
-                            if ((prop) && (escb->propagate)) continue;
-                            if ((!escb->just_added)
-                                && (!escb->delete_me))
-                              {
-                                 eina_array_push(&run, escb);
-                                 r = 2;
-                              }
-                         }
-                    }
-               }
-          }
-     }
-
-   while ((escb = eina_array_pop(&run)))
-     {
-        escb->func(escb->data, ed->obj, sig, source);
-        if (_edje_block_break(ed))
-          return 0;
-        if ((signal_ppat->delete_me) || (source_ppat->delete_me))
-          return 0;
-     }
-   eina_array_flush(&run);
-
-   return r;
-}
-
-
 static Edje_States*
 _edje_match_fn(const Edje_Patterns      *ppat,
                const char               *string,
@@ -579,115 +402,560 @@ edje_match_collection_dir_exec(const Edje_Patterns      *ppat,
    return r;
 }
 
+void
+edje_match_patterns_free(Edje_Patterns *ppat)
+{
+   if (!ppat) return ;
+
+   ppat->delete_me = 1;
+   ppat->ref--;
+   if (ppat->ref > 0) return;
+   _edje_match_states_free(ppat->states, 2);
+   free(ppat);
+}
+
+void
+_edje_signals_sources_patterns_clean(Edje_Signals_Sources_Patterns *ssp)
+{
+   edje_match_dfa_free(ssp->signals_patterns);
+   edje_match_dfa_free(ssp->sources_patterns);
+   ssp->signals_patterns = NULL;
+   ssp->sources_patterns = NULL;
+}
+
+/* Lazily determinized automaton, used for the programs and the callbacks.
+ * Every state is the set of pattern positions reachable after reading a
+ * string, its transitions are only computed the first time they are
+ * walked and the patterns it matches are kept in a bitset. The bytes no
+ * pattern tells apart share a class, and the transitions go by class, as
+ * the callbacks get their own automata per object. */
+
+#define EDJE_MATCH_DFA_STATES_MAX 128
+
+typedef struct _Edje_Match_Dfa_State Edje_Match_Dfa_State;
+struct _Edje_Match_Dfa_State
+{
+   short                *next; /* one per class, -1 when not computed yet */
+   unsigned int         *accept; /* the patterns matched when ending here */
+   unsigned int          hash;
+   size_t                count;
+   Edje_State            positions[1];
+};
+
+struct _Edje_Match_Dfa
+{
+   int                   ref;
+   Eina_Bool             delete_me;
+
+   const char          **patterns;
+   size_t               *finals;
+   size_t                patterns_size;
+   size_t                max_length;
+   unsigned int          words;
+
+   Edje_Match_Dfa_State **states;
+   unsigned int          states_count;
+   unsigned int          states_size;
+   unsigned int          flushes;
+   int                   start;
+
+   unsigned char         classes[256];
+   unsigned int          classes_count;
+
+   /* scratch space to build a new state */
+   Edje_State           *work;
+   Eina_Bool            *has;
+};
+
+static void
+_edje_match_dfa_states_flush(Edje_Match_Dfa *dfa)
+{
+   unsigned int i;
+
+   for (i = 0; i < dfa->states_count; ++i)
+     {
+        free(dfa->states[i]->next);
+        free(dfa->states[i]);
+     }
+   dfa->states_count = 0;
+   dfa->start = -1;
+   dfa->flushes++;
+}
+
+static int
+_edje_match_dfa_position_cmp(const void *a, const void *b)
+{
+   const Edje_State *sa = a;
+   const Edje_State *sb = b;
+
+   if (sa->idx != sb->idx) return sa->idx < sb->idx ? -1 : 1;
+   if (sa->pos != sb->pos) return sa->pos < sb->pos ? -1 : 1;
+   return 0;
+}
+
+/* Split the bytes where a token of a pattern may match on one side and
+ * not on the other. The tokens compare plain chars, so the signed halves
+ * are split too. */
+static void
+_edje_match_dfa_classes_build(Edje_Match_Dfa *dfa)
+{
+   Eina_Bool bounds[257];
+   unsigned int c, cls;
+   size_t i;
+
+   memset(bounds, 0, sizeof (bounds));
+   bounds[128] = EINA_TRUE;
+
+#define EDJE_MATCH_DFA_BOUNDS(A, B)                              \
+   {                                                             \
+      bounds[(unsigned char)(A)] = EINA_TRUE;                    \
+      bounds[(unsigned char)(B) + 1] = EINA_TRUE;                \
+   }
+
+   for (i = 0; i < dfa->patterns_size; ++i)
+     {
+        const char *pat = dfa->patterns[i];
+
+        while (*pat)
+          {
+             if ((*pat == '*') || (*pat == '?'))
+               pat++;
+             else if (*pat == '\\')
+               {
+                  if (!pat[1]) break;
+                  EDJE_MATCH_DFA_BOUNDS(pat[1], pat[1]);
+                  pat += 2;
+               }
+             else if (*pat == '[')
+               {
+                  /* the same walk as _edje_match_patterns_exec_class() */
+                  pat++;
+                  if (*pat == '!') pat++;
+                  do
+                    {
+                       if (!*pat) break;
+                       if ((pat[1] == '-') && (pat[2] != ']'))
+                         {
+                            EDJE_MATCH_DFA_BOUNDS(pat[0], pat[2]);
+                            pat += 3;
+                         }
+                       else
+                         {
+                            EDJE_MATCH_DFA_BOUNDS(pat[0], pat[0]);
+                            pat++;
+                         }
+                    }
+                  while (*pat && *pat != ']');
+                  if (!*pat) break;
+                  pat++;
+               }
+             else
+               {
+                  EDJE_MATCH_DFA_BOUNDS(*pat, *pat);
+                  pat++;
+               }
+          }
+     }
+
+#undef EDJE_MATCH_DFA_BOUNDS
+
+   cls = 0;
+   for (c = 0; c < 256; ++c)
+     {
+        if ((c) && (bounds[c])) cls++;
+        dfa->classes[c] = cls;
+     }
+   dfa->classes_count = cls + 1;
+}
+
+/* add a position and the ones following the stars right after it */
+static size_t
+_edje_match_dfa_closure(Edje_Match_Dfa *dfa, size_t n, size_t idx, size_t pos)
+{
+   const char *pattern = dfa->patterns[idx];
+
+   while (1)
+     {
+        size_t i = idx * (dfa->max_length + 1) + pos;
+
+        if (!dfa->has[i])
+          {
+             dfa->has[i] = 1;
+             dfa->work[n].idx = idx;
+             dfa->work[n].pos = pos;
+             n++;
+          }
+        if (pattern[pos] != '*') break;
+        pos++;
+     }
+   return n;
+}
+
+static void
+_edje_match_dfa_work_clear(Edje_Match_Dfa *dfa, size_t n)
+{
+   size_t i;
+
+   for (i = 0; i < n; ++i)
+     dfa->has[dfa->work[i].idx * (dfa->max_length + 1) + dfa->work[i].pos] = 0;
+}
+
+/* Return the state made of the n positions of the scratch space, creating
+ * it if needed. */
+static int
+_edje_match_dfa_state_get(Edje_Match_Dfa *dfa, size_t n)
+{
+   Edje_Match_Dfa_State *st;
+   unsigned int hash = 2166136261U;
+   unsigned int i;
+
+   _edje_match_dfa_work_clear(dfa, n);
+   qsort(dfa->work, n, sizeof (Edje_State), _edje_match_dfa_position_cmp);
+   for (i = 0; i < n; ++i)
+     {
+        hash = (hash ^ dfa->work[i].idx) * 16777619U;
+        hash = (hash ^ dfa->work[i].pos) * 16777619U;
+     }
+
+   for (i = 0; i < dfa->states_count; ++i)
+     {
+        st = dfa->states[i];
+        if ((st->hash == hash) && (st->count == n) &&
+            (!memcmp(st->positions, dfa->work, n * sizeof (Edje_State))))
+          return i;
+     }
+
+   if (dfa->states_count == dfa->states_size)
+     {
+        /* a pathological set of patterns could make it grow without end */
+        if (dfa->states_size == EDJE_MATCH_DFA_STATES_MAX)
+          _edje_match_dfa_states_flush(dfa);
+        else
+          {
+             Edje_Match_Dfa_State **states;
+             unsigned int size;
+
+             size = dfa->states_size ? dfa->states_size * 2 : 8;
+             if (size > EDJE_MATCH_DFA_STATES_MAX)
+               size = EDJE_MATCH_DFA_STATES_MAX;
+             states = realloc(dfa->states, size * sizeof (Edje_Match_Dfa_State *));
+             if (!states) return -1;
+             dfa->states = states;
+             dfa->states_size = size;
+          }
+     }
+
+   st = malloc(sizeof (Edje_Match_Dfa_State)
+               + (n ? n - 1 : 0) * sizeof (Edje_State)
+               + dfa->words * sizeof (unsigned int));
+   if (!st) return -1;
+   st->next = NULL;
+   st->accept = (unsigned int *)(st->positions + (n ? n : 1));
+   st->hash = hash;
+   st->count = n;
+   memcpy(st->positions, dfa->work, n * sizeof (Edje_State));
+   memset(st->accept, 0, dfa->words * sizeof (unsigned int));
+   for (i = 0; i < n; ++i)
+     if (st->positions[i].pos >= dfa->finals[st->positions[i].idx])
+       st->accept[st->positions[i].idx / 32] |= 1U << (st->positions[i].idx % 32);
+
+   dfa->states[dfa->states_count] = st;
+   return dfa->states_count++;
+}
+
+static int
+_edje_match_dfa_start(Edje_Match_Dfa *dfa)
+{
+   size_t n = 0;
+   size_t i;
+
+   for (i = 0; i < dfa->patterns_size; ++i)
+     n = _edje_match_dfa_closure(dfa, n, i, 0);
+   return _edje_match_dfa_state_get(dfa, n);
+}
+
+static int
+_edje_match_dfa_step(Edje_Match_Dfa *dfa, int from, unsigned char c)
+{
+   Edje_Match_Dfa_State *st = dfa->states[from];
+   unsigned int flushes;
+   size_t n = 0;
+   size_t i;
+   int to;
+
+   if (!st->next)
+     {
+        st->next = malloc(dfa->classes_count * sizeof (short));
+        if (!st->next) return -1;
+        memset(st->next, 0xff, dfa->classes_count * sizeof (short));
+     }
+
+   for (i = 0; i < st->count; ++i)
+     {
+        const size_t idx = st->positions[i].idx;
+        const size_t pos = st->positions[i].pos;
+        const char *pattern = dfa->patterns[idx];
+
+        if (!pattern[pos])
+          continue;
+        else if (pattern[pos] == '*')
+          n = _edje_match_dfa_closure(dfa, n, idx, pos);
+        else
+          {
+             size_t m;
+
+             if (_edje_match_patterns_exec_token(pattern + pos, c, &m) != EDJE_MATCH_OK)
+               {
+                  _edje_match_dfa_work_clear(dfa, n);
+                  return -1;
+               }
+             if (m)
+               n = _edje_match_dfa_closure(dfa, n, idx, pos + m);
+          }
+     }
+
+   flushes = dfa->flushes;
+   to = _edje_match_dfa_state_get(dfa, n);
+   /* the source state is gone if the states got flushed */
+   if ((to >= 0) && (flushes == dfa->flushes))
+     st->next[dfa->classes[c]] = to;
+   return to;
+}
+
+/* Walk string, accept is set to the bitset of the matched patterns or to
+ * NULL when none does. Return EINA_FALSE on a syntax error. */
+static Eina_Bool
+_edje_match_dfa_exec(Edje_Match_Dfa *dfa, const char *string, const unsigned int **accept)
+{
+   const unsigned char *c;
+   int s;
+
+   *accept = NULL;
+   if (dfa->start < 0)
+     {
+        dfa->start = _edje_match_dfa_start(dfa);
+        if (dfa->start < 0) return EINA_FALSE;
+     }
+
+   s = dfa->start;
+   for (c = (const unsigned char *)string; *c; ++c)
+     {
+        Edje_Match_Dfa_State *st = dfa->states[s];
+
+        if (!st->count) return EINA_TRUE;
+        if ((st->next) && (st->next[dfa->classes[*c]] >= 0))
+          s = st->next[dfa->classes[*c]];
+        else
+          {
+             s = _edje_match_dfa_step(dfa, s, *c);
+             if (s < 0) return EINA_FALSE;
+          }
+     }
+
+   *accept = dfa->states[s]->accept;
+   return EINA_TRUE;
+}
+
+#define EDJE_MATCH_DFA_NEW(Func, Type, Source)                  \
+  Edje_Match_Dfa*                                               \
+  Func(Type * const *lst, unsigned int count)                   \
+  {                                                             \
+     Edje_Match_Dfa     *r;                                     \
+     size_t              i;                                     \
+                                                                \
+     if (!lst || count == 0)                                    \
+       return NULL;                                             \
+                                                                \
+     r = calloc(1, sizeof (Edje_Match_Dfa)                      \
+                + count * sizeof (*r->patterns)                 \
+                + count * sizeof (*r->finals));                 \
+     if (!r) return NULL;                                       \
+                                                                \
+     r->patterns = (const char **) (r + 1);                     \
+     r->finals = (size_t *) (r->patterns + count);              \
+     r->patterns_size = count;                                  \
+     r->ref = 1;                                                \
+     r->words = (count + 31) / 32;                              \
+     r->start = -1;                                             \
+                                                                \
+     for (i = 0; i < count; ++i)                                \
+       {                                                        \
+          const char    *str;                                   \
+          size_t         j;                                     \
+                                                                \
+          if (!lst[i])                                          \
+            {                                                   \
+               free(r);                                         \
+               return NULL;                                     \
+            }                                                   \
+                                                                \
+          str = lst[i]->Source;                                 \
+          if (!str) str = "";                                   \
+          r->patterns[i] = str;                                 \
+                                                                \
+          r->finals[i] = 0;                                     \
+          for (j = 0; str[j]; ++j)                              \
+            if (str[j] != '*')                                  \
+              r->finals[i] = j + 1;                             \
+                                                                \
+          if (j > r->max_length)                                \
+            r->max_length = j;                                  \
+       }                                                        \
+                                                                \
+     _edje_match_dfa_classes_build(r);                          \
+     r->work = malloc(count * (r->max_length + 1)               \
+                      * sizeof (Edje_State));                   \
+     r->has = calloc(count * (r->max_length + 1),               \
+                     sizeof (Eina_Bool));                       \
+     if (!r->work || !r->has)                                   \
+       {                                                        \
+          edje_match_dfa_free(r);                               \
+          return NULL;                                          \
+       }                                                        \
+                                                                \
+     return r;                                                  \
+  }
+
+EDJE_MATCH_DFA_NEW(edje_match_programs_signal_dfa_new,
+                   Edje_Program,
+                   signal);
+EDJE_MATCH_DFA_NEW(edje_match_programs_source_dfa_new,
+                   Edje_Program,
+                   source);
+EDJE_MATCH_DFA_NEW(edje_match_callback_signal_dfa_new,
+                   Edje_Signal_Callback,
+                   signal);
+EDJE_MATCH_DFA_NEW(edje_match_callback_source_dfa_new,
+                   Edje_Signal_Callback,
+                   source);
+
+static void
+_edje_match_dfa_del(Edje_Match_Dfa *dfa)
+{
+   _edje_match_dfa_states_flush(dfa);
+   free(dfa->states);
+   free(dfa->work);
+   free(dfa->has);
+   free(dfa);
+}
+
+void
+edje_match_dfa_free(Edje_Match_Dfa *dfa)
+{
+   if (!dfa) return ;
+
+   dfa->delete_me = 1;
+   dfa->ref--;
+   if (dfa->ref > 0) return;
+   _edje_match_dfa_del(dfa);
+}
+
 Eina_Bool
-edje_match_programs_exec(const Edje_Patterns    *ppat_signal,
-                         const Edje_Patterns    *ppat_source,
+edje_match_programs_exec(Edje_Match_Dfa         *dfa_signal,
+                         Edje_Match_Dfa         *dfa_source,
                          const char             *sig,
                          const char             *source,
                          Edje_Program          **programs,
                          Eina_Bool (*func)(Edje_Program *pr, void *data),
-                         void                   *data,
-                         Eina_Bool               prop)
+                         void                   *data)
 {
-   Edje_States  *signal_result;
-   Edje_States  *source_result;
-   Eina_Bool     r = EINA_FALSE;
+   const unsigned int *signal_accept;
+   const unsigned int *source_accept;
+   unsigned int        w;
 
    /* under high memory presure, they could be NULL */
-   if (!ppat_source || !ppat_signal) return EINA_FALSE;
-
-   _edje_match_patterns_exec_init_states(ppat_signal->states,
-                                         ppat_signal->patterns_size,
-                                         ppat_signal->max_length);
-   _edje_match_patterns_exec_init_states(ppat_source->states,
-                                         ppat_source->patterns_size,
-                                         ppat_source->max_length);
-
-   signal_result = _edje_match_fn(ppat_signal, sig, ppat_signal->states);
-   source_result = _edje_match_fn(ppat_source, source, ppat_source->states);
-
-   if (signal_result && source_result)
-      r = edje_match_programs_exec_check_finals(ppat_signal->finals,
-                                                ppat_source->finals,
-                                                signal_result,
-                                                source_result,
-                                                programs,
-                                                func,
-                                                data,
-                                                prop);
-   return r;
+   if (!dfa_signal || !dfa_source) return EINA_FALSE;
+
+   if (!_edje_match_dfa_exec(dfa_signal, sig, &signal_accept))
+     return EINA_FALSE;
+   if (!signal_accept) return EINA_TRUE;
+   if (!_edje_match_dfa_exec(dfa_source, source, &source_accept))
+     return EINA_FALSE;
+   if (!source_accept) return EINA_TRUE;
+
+   /* both automata were built from the same programs */
+   for (w = 0; w < dfa_signal->words; ++w)
+     {
+        unsigned int bits = signal_accept[w] & source_accept[w];
+        unsigned int i;
+
+        for (i = w * 32; bits; ++i, bits >>= 1)
+          {
+             if (!(bits & 1)) continue;
+             if (programs[i] && func(programs[i], data))
+               return EINA_FALSE;
+          }
+     }
+
+   return EINA_TRUE;
 }
 
 int
-edje_match_callback_exec(Edje_Patterns          *ppat_signal,
-                         Edje_Patterns          *ppat_source,
+edje_match_callback_exec(Edje_Match_Dfa         *dfa_signal,
+                         Edje_Match_Dfa         *dfa_source,
                          const char             *sig,
                          const char             *source,
-                         Eina_List              *callbacks,
+                         Edje_Signal_Callback  **callbacks,
                          Edje                   *ed,
-                         Eina_Bool               prop
-                        )
+                         Eina_Bool               prop)
 {
-   Edje_States  *signal_result;
-   Edje_States  *source_result;
-   int           r = 0;
+   Edje_Signal_Callback *escb;
+   const unsigned int   *signal_accept;
+   const unsigned int   *source_accept;
+   Eina_Array            run;
+   unsigned int          w;
+   unsigned int          i;
+   int                   r = 1;
 
    /* under high memory presure, they could be NULL */
-   if (!ppat_source || !ppat_signal) return 0;
-
-   ppat_signal->ref++;
-   ppat_source->ref++;
-   _edje_match_patterns_exec_init_states(ppat_signal->states,
-                                         ppat_signal->patterns_size,
-                                         ppat_signal->max_length);
-   _edje_match_patterns_exec_init_states(ppat_source->states,
-                                         ppat_source->patterns_size,
-                                         ppat_source->max_length);
-
-   signal_result = _edje_match_fn(ppat_signal, sig, ppat_signal->states);
-   source_result = _edje_match_fn(ppat_source, source, ppat_source->states);
-
-   if (signal_result && source_result)
-      r = edje_match_callback_exec_check_finals(ppat_signal,
-                                                ppat_source,
-                                                ppat_signal->finals,
-                                                ppat_source->finals,
-                                                signal_result,
-                                                source_result,
-                                                sig,
-                                                source,
-                                                callbacks,
-                                                ed,
-                                                prop);
-   ppat_signal->ref--;
-   ppat_source->ref--;
-   if (ppat_signal->ref <= 0) edje_match_patterns_free(ppat_signal);
-   if (ppat_source->ref <= 0) edje_match_patterns_free(ppat_source);
-   return r;
-}
+   if (!dfa_source || !dfa_signal) return 0;
 
-void
-edje_match_patterns_free(Edje_Patterns *ppat)
-{
-   if (!ppat) return ;
+   if (!_edje_match_dfa_exec(dfa_signal, sig, &signal_accept))
+     return 0;
+   if (!signal_accept) return 1;
+   if (!_edje_match_dfa_exec(dfa_source, source, &source_accept))
+     return 0;
+   if (!source_accept) return 1;
 
-   ppat->delete_me = 1;
-   ppat->ref--;
-   if (ppat->ref > 0) return;
-   _edje_match_states_free(ppat->states, 2);
-   free(ppat);
-}
+   eina_array_step_set(&run, sizeof (Eina_Array), 4);
 
-void
-_edje_signals_sources_patterns_clean(Edje_Signals_Sources_Patterns *ssp)
-{
-   if (!ssp->signals_patterns)
-     return;
+   /* callbacks are indexed like the patterns they were compiled from */
+   for (w = 0; w < dfa_signal->words; ++w)
+     {
+        unsigned int bits = signal_accept[w] & source_accept[w];
 
-   edje_match_patterns_free(ssp->signals_patterns);
-   edje_match_patterns_free(ssp->sources_patterns);
-   ssp->signals_patterns = NULL;
-   ssp->sources_patterns = NULL;
+        for (i = w * 32; bits; ++i, bits >>= 1)
+          {
+             if (!(bits & 1)) continue;
+             escb = callbacks[i];
+             if ((prop) && (escb->propagate)) continue;
+             if ((!escb->just_added) && (!escb->delete_me))
+               {
+                  eina_array_push(&run, escb);
+                  r = 2;
+               }
+          }
+     }
+
+   /* a callback can rebuild the patterns, keep them around until done */
+   dfa_signal->ref++;
+   dfa_source->ref++;
+   for (i = 0; i < eina_array_count_get(&run); ++i)
+     {
+        escb = eina_array_data_get(&run, i);
+        escb->func(escb->data, ed->obj, sig, source);
+        if ((_edje_block_break(ed)) ||
+            (dfa_signal->delete_me) || (dfa_source->delete_me))
+          {
+             r = 0;
+             break;
+          }
+     }
+   eina_array_flush(&run);
+   if (--dfa_signal->ref <= 0) _edje_match_dfa_del(dfa_signal);
+   if (--dfa_source->ref <= 0) _edje_match_dfa_del(dfa_source);
+
+   return r;
 }
 
 static Eina_Rbtree_Direction
@@ -759,15 +1027,21 @@ edje_match_program_hash_build(Edje_Program * const *programs,
    return result;
 }
 
-Eina_List *
+Edje_Signal_Callback **
 edje_match_callback_hash_build(const Eina_List *callbacks,
+			       unsigned int *count,
 			       Eina_Rbtree **tree)
 {
-   Eina_List *result = NULL;
+   Edje_Signal_Callback **result;
    Eina_Rbtree *new = NULL;
    Edje_Signal_Callback *callback;
    const Eina_List *l;
 
+   *count = 0;
+   *tree = NULL;
+   result = malloc(sizeof (Edje_Signal_Callback *) * eina_list_count(callbacks));
+   if (!result) return NULL;
+
    EINA_LIST_FOREACH(callbacks, l, callback)
      {
 	if (callback->signal && !strpbrk(callback->signal, "*?[\\")
@@ -793,9 +1067,14 @@ edje_match_callback_hash_build(const Eina_List *callbacks,
 	     item->list = eina_list_prepend(item->list, callback);
 	  }
 	else
-           result = eina_list_prepend(result, callback);
+           result[(*count)++] = callback;
      }
 
+   if (!*count)
+     {
+        free(result);
+        result = NULL;
+     }
    *tree = new;
    return result;
 }
@@ -6,10 +6,118 @@ static int _injob = 0;
 static Ecore_Job *_job = NULL;
 static Ecore_Timer *_job_loss_timer = NULL;
 
-static Eina_List *msgq = NULL;
-static Eina_List *tmp_msgq = NULL;
-static int tmp_msgq_processing = 0;
-static int tmp_msgq_restart = 0;
+/* a message and its payload live in a single block, small enough ones
+ * come from this pool */
+#define EDJE_MESSAGE_HEADER_SIZE ((sizeof (Edje_Message) + 7) & ~((size_t)7))
+#define EDJE_MESSAGE_POOL_PAYLOAD 80
+static Eina_Mempool *_edje_message_mp = NULL;
+
+/* objects with pending messages, in the order they got their first one */
+static Edje *_ready_first = NULL;
+static Edje *_ready_last = NULL;
+static unsigned int _ready_count = 0;
+
+/* batching statistics of the global flushes */
+static double _queued_time = 0.0;
+static double _flush_latency = 0.0;
+static double _flush_latency_max = 0.0;
+static unsigned int _flush_count = 0;
+static unsigned int _flush_messages = 0;
+
+static void
+_edje_message_ready_add(Edje *ed)
+{
+   if (ed->message.ready) return;
+   ed->message.ready_prev = _ready_last;
+   ed->message.ready_next = NULL;
+   if (_ready_last) _ready_last->message.ready_next = ed;
+   else _ready_first = ed;
+   _ready_last = ed;
+   _ready_count++;
+   ed->message.ready = 1;
+}
+
+static void
+_edje_message_ready_del(Edje *ed)
+{
+   if (!ed->message.ready) return;
+   if (ed->message.ready_prev)
+     ed->message.ready_prev->message.ready_next = ed->message.ready_next;
+   else _ready_first = ed->message.ready_next;
+   if (ed->message.ready_next)
+     ed->message.ready_next->message.ready_prev = ed->message.ready_prev;
+   else _ready_last = ed->message.ready_prev;
+   ed->message.ready_prev = NULL;
+   ed->message.ready_next = NULL;
+   _ready_count--;
+   ed->message.ready = 0;
+}
+
+static Eina_Bool
+_edje_message_push(Edje *ed, Edje_Message *em)
+{
+   if (ed->message.num == ed->message.size)
+     {
+        Edje_Message **queue;
+        unsigned int size, i;
+
+        size = ed->message.size ? ed->message.size * 2 : 8;
+        queue = malloc(size * sizeof (Edje_Message *));
+        if (!queue) return EINA_FALSE;
+        for (i = 0; i < ed->message.num; i++)
+          queue[i] = ed->message.queue[(ed->message.first + i) & (ed->message.size - 1)];
+        free(ed->message.queue);
+        ed->message.queue = queue;
+        ed->message.first = 0;
+        ed->message.size = size;
+     }
+   ed->message.queue[(ed->message.first + ed->message.num) & (ed->message.size - 1)] = em;
+   ed->message.num++;
+   _edje_message_ready_add(ed);
+   return EINA_TRUE;
+}
+
+static Edje_Message *
+_edje_message_pop(Edje *ed)
+{
+   Edje_Message *em;
+
+   if (!ed->message.num) return NULL;
+   em = ed->message.queue[ed->message.first];
+   ed->message.first = (ed->message.first + 1) & (ed->message.size - 1);
+   ed->message.num--;
+   return em;
+}
+
+/* Process the n first messages of the object, the ones queued while doing
+ * so wait for the next pass. Return EINA_FALSE if the object got deleted. */
+static Eina_Bool
+_edje_message_flush(Edje *ed, unsigned int n)
+{
+   Edje_Message *em;
+
+   /* messages are popped one by one, so a callback deleting them or
+    * processing them itself leaves the queue in a sane state */
+   while ((n-- > 0) && (em = _edje_message_pop(ed)))
+     {
+        if (!ed->delete_me)
+          {
+             ed->processing_messages++;
+             _flush_messages++;
+             _edje_message_process(em);
+             _edje_message_free(em);
+             ed->processing_messages--;
+          }
+        else
+          _edje_message_free(em);
+        if ((ed->processing_messages == 0) && (ed->delete_me))
+          {
+             _edje_del(ed);
+             return EINA_FALSE;
+          }
+     }
+   return EINA_TRUE;
+}
 
 /*============================================================================*
  *                                   API                                      *
@@ -52,85 +160,13 @@ edje_object_message_handler_set(Evas_Object *obj, Edje_Message_Handler_Cb func,
 EAPI void
 edje_object_message_signal_process(Evas_Object *obj)
 {
-   Eina_List *l, *ln, *tmpq = NULL;
    Edje *ed;
-   Edje_Message *em;
-   int gotos = 0;
 
    ed = _edje_fetch(obj);
    if (!ed) return;
 
-   for (l = msgq; l; )
-     {
-        ln = l->next;
-        em = l->data;
-        if (em->edje == ed)
-          {
-             tmpq = eina_list_append(tmpq, em);
-             msgq = eina_list_remove_list(msgq, l);
-          }
-        l = ln;
-     }
-   /* a temporary message queue */
-   if (tmp_msgq)
-     {
-	while (tmpq)
-	  {
-	     tmp_msgq = eina_list_append(tmp_msgq, tmpq->data);
-	     tmpq = eina_list_remove_list(tmpq, tmpq);
-	  }
-     }
-   else
-     {
-	tmp_msgq = tmpq;
-	tmpq = NULL;
-     }
-
-   tmp_msgq_processing++;
-again:
-   EINA_LIST_FOREACH_SAFE(tmp_msgq, l, ln, em)
-     {
-        if (em->edje != ed) continue;
-	tmp_msgq = eina_list_remove_list(tmp_msgq, l);
-        if (!ed->delete_me)
-          {
-             ed->processing_messages++;
-             _edje_message_process(em);
-             _edje_message_free(em);
-             ed->processing_messages--;
-          }
-        else
-           _edje_message_free(em);
-        if (ed->processing_messages == 0)
-          {
-             if (ed->delete_me) _edje_del(ed);
-          }
-        // if some child callback in _edje_message_process called
-        // edje_object_message_signal_process() or
-        // edje_message_signal_process() then those will mark the restart
-        // flag when they finish - it mabsicammyt means tmp_msgq and
-        // any item in it has potentially become invalid - so that means l
-        // and ln could be rogue pointers, so start again from the beginning
-        // and skip anything that is not this object and process only what is.
-        // to avoid self-feeding loops allow a max of 1024 loops.
-        if (tmp_msgq_restart)
-          {
-             tmp_msgq_restart = 0;
-             gotos++;
-             if (gotos < 1024) goto again;
-             else
-               {
-                  WRN("Edje is in a self-feeding message loop (> 1024 gotos needed in a row)");
-                  goto end;
-               }
-          }
-     }
-end:
-   tmp_msgq_processing--;
-   if (tmp_msgq_processing == 0)
-      tmp_msgq_restart = 0;
-   else
-      tmp_msgq_restart = 1;
+   _edje_message_ready_del(ed);
+   _edje_message_flush(ed, ed->message.num);
 }
 
 
@@ -141,6 +177,16 @@ edje_message_signal_process(void)
 }
 
 
+EAPI void
+edje_message_signal_stats_get(unsigned int *flushes, unsigned int *messages, double *latency, double *latency_max)
+{
+   if (flushes) *flushes = _flush_count;
+   if (messages) *messages = _flush_messages;
+   if (latency) *latency = _flush_count ? _flush_latency / _flush_count : 0.0;
+   if (latency_max) *latency_max = _flush_latency_max;
+}
+
+
 static Eina_Bool
 _edje_dummy_timer(void *data __UNUSED__)
 {
@@ -172,15 +218,47 @@ _edje_job_loss_timer(void *data __UNUSED__)
    return ECORE_CALLBACK_CANCEL;
 }
 
+/* Make sure a flush is pending, the job when called from the main loop or
+ * a short timer bringing one back when the queue is being processed. */
+static void
+_edje_message_schedule(void)
+{
+   if (_injob > 0)
+     {
+        if ((!_job) && (!_job_loss_timer))
+          _job_loss_timer = ecore_timer_add(0.001, _edje_job_loss_timer, NULL);
+     }
+   else if (!_job)
+     {
+        _job = ecore_job_add(_edje_job, NULL);
+        if (_job_loss_timer)
+          {
+             ecore_timer_del(_job_loss_timer);
+             _job_loss_timer = NULL;
+          }
+     }
+}
+
 void
 _edje_message_init(void)
 {
+   _edje_message_mp = eina_mempool_add("chained_mempool",
+                                       "Edje_Message", NULL,
+                                       EDJE_MESSAGE_HEADER_SIZE + EDJE_MESSAGE_POOL_PAYLOAD,
+                                       64);
+   if (!_edje_message_mp)
+     WRN("Mempool for Edje_Message cannot be allocated, using malloc.");
 }
 
 void
 _edje_message_shutdown(void)
 {
    _edje_message_queue_clear();
+   if (_edje_message_mp)
+     {
+        eina_mempool_del(_edje_message_mp);
+        _edje_message_mp = NULL;
+     }
    if (_job_loss_timer)
      {
         ecore_timer_del(_job_loss_timer);
@@ -210,193 +288,187 @@ _edje_message_cb_set(Edje *ed, void (*func) (void *data, Evas_Object *obj, Edje_
 }
 
 Edje_Message *
-_edje_message_new(Edje *ed, Edje_Queue queue, Edje_Message_Type type, int id)
+_edje_message_new(Edje *ed, Edje_Queue queue, Edje_Message_Type type, int id, size_t size)
 {
    Edje_Message *em;
+   Eina_Bool pooled = EINA_FALSE;
 
-   em = calloc(1, sizeof(Edje_Message));
+   if ((_edje_message_mp) && (size <= EDJE_MESSAGE_POOL_PAYLOAD))
+     {
+        em = eina_mempool_malloc(_edje_message_mp, EDJE_MESSAGE_HEADER_SIZE + size);
+        pooled = !!em;
+     }
+   else
+     em = malloc(EDJE_MESSAGE_HEADER_SIZE + size);
    if (!em) return NULL;
+   memset(em, 0, sizeof (Edje_Message));
    em->edje = ed;
    em->queue = queue;
    em->type = type;
    em->id = id;
-   em->edje->message.num++;
+   em->pooled = pooled;
+   if (size) em->msg = (unsigned char *)em + EDJE_MESSAGE_HEADER_SIZE;
    return em;
 }
 
+static void
+_edje_message_signal_free(Edje_Message_Signal *emsg)
+{
+   if (emsg->sig) eina_stringshare_del(emsg->sig);
+   if (emsg->src) eina_stringshare_del(emsg->src);
+   if (emsg->data && (--(emsg->data->ref) == 0))
+     {
+        if (emsg->data->free_func)
+          {
+             emsg->data->free_func(emsg->data->data);
+          }
+        free(emsg->data);
+     }
+}
+
+static void
+_edje_message_signal_copy(Edje_Message_Signal *dst, const Edje_Message_Signal *src)
+{
+   /* sig and src are stringshares, just take a reference */
+   dst->sig = eina_stringshare_ref(src->sig);
+   dst->src = eina_stringshare_ref(src->src);
+   dst->data = src->data;
+   if (dst->data) dst->data->ref++;
+}
+
 void
 _edje_message_free(Edje_Message *em)
 {
-   if (em->msg)
+   if ((em->type == EDJE_MESSAGE_SIGNAL) && (em->msg))
+     _edje_message_signal_free((Edje_Message_Signal *)em->msg);
+   else if ((em->type == EDJE_MESSAGE_SIGNAL_SET) && (em->msg))
      {
-	int i;
+        Edje_Message_Signal_Set *emsg;
+        int i;
+
+        emsg = (Edje_Message_Signal_Set *)em->msg;
+        for (i = 0; i < emsg->count; i++)
+          _edje_message_signal_free(&emsg->sig[i]);
+     }
+   if (em->pooled) eina_mempool_free(_edje_message_mp, em);
+   else free(em);
+}
+
+/* the extra elements of the set, the struct already holds one */
+#define EDJE_MESSAGE_SET_EXTRA(Count, Type) \
+   (((Count) > 1) ? ((Count) - 1) * sizeof (Type) : 0)
+
+static size_t
+_edje_message_payload_size(Edje_Message_Type type, void *emsg)
+{
+   size_t size = 0;
+   int i;
+
+   switch (type)
+     {
+      case EDJE_MESSAGE_SIGNAL:
+	return sizeof (Edje_Message_Signal);
+      case EDJE_MESSAGE_SIGNAL_SET:
+	return sizeof (Edje_Message_Signal_Set) +
+	  EDJE_MESSAGE_SET_EXTRA(((Edje_Message_Signal_Set *)emsg)->count, Edje_Message_Signal);
+      case EDJE_MESSAGE_STRING:
+	return sizeof (Edje_Message_String) +
+	  strlen(((Edje_Message_String *)emsg)->str) + 1;
+      case EDJE_MESSAGE_INT:
+	return sizeof (Edje_Message_Int);
+      case EDJE_MESSAGE_FLOAT:
+	return sizeof (Edje_Message_Float);
+      case EDJE_MESSAGE_STRING_SET:
+	  {
+	     Edje_Message_String_Set *emsg2 = emsg;
 
-	switch (em->type)
+	     size = sizeof (Edje_Message_String_Set) +
+	       EDJE_MESSAGE_SET_EXTRA(emsg2->count, char *);
+	     for (i = 0; i < emsg2->count; i++)
+	       size += strlen(emsg2->str[i]) + 1;
+	     return size;
+	  }
+      case EDJE_MESSAGE_INT_SET:
+	return sizeof (Edje_Message_Int_Set) +
+	  EDJE_MESSAGE_SET_EXTRA(((Edje_Message_Int_Set *)emsg)->count, int);
+      case EDJE_MESSAGE_FLOAT_SET:
+	return sizeof (Edje_Message_Float_Set) +
+	  EDJE_MESSAGE_SET_EXTRA(((Edje_Message_Float_Set *)emsg)->count, double);
+      case EDJE_MESSAGE_STRING_INT:
+	return sizeof (Edje_Message_String_Int) +
+	  strlen(((Edje_Message_String_Int *)emsg)->str) + 1;
+      case EDJE_MESSAGE_STRING_FLOAT:
+	return sizeof (Edje_Message_String_Float) +
+	  strlen(((Edje_Message_String_Float *)emsg)->str) + 1;
+      case EDJE_MESSAGE_STRING_INT_SET:
+	  {
+	     Edje_Message_String_Int_Set *emsg2 = emsg;
+
+	     return sizeof (Edje_Message_String_Int_Set) +
+	       EDJE_MESSAGE_SET_EXTRA(emsg2->count, int) +
+	       strlen(emsg2->str) + 1;
+	  }
+      case EDJE_MESSAGE_STRING_FLOAT_SET:
 	  {
-	   case EDJE_MESSAGE_STRING:
-	       {
-		  Edje_Message_String *emsg;
-
-		  emsg = (Edje_Message_String *)em->msg;
-		  free(emsg->str);
-		  free(emsg);
-	       }
-	     break;
-	   case EDJE_MESSAGE_INT:
-	       {
-		  Edje_Message_Int *emsg;
-
-		  emsg = (Edje_Message_Int *)em->msg;
-		  free(emsg);
-	       }
-	     break;
-	   case EDJE_MESSAGE_FLOAT:
-	       {
-		  Edje_Message_Float *emsg;
-
-		  emsg = (Edje_Message_Float *)em->msg;
-		  free(emsg);
-	       }
-	     break;
-	   case EDJE_MESSAGE_INT_SET:
-	       {
-		  Edje_Message_Int_Set *emsg;
-
-		  emsg = (Edje_Message_Int_Set *)em->msg;
-		  free(emsg);
-	       }
-	     break;
-	   case EDJE_MESSAGE_FLOAT_SET:
-	       {
-		  Edje_Message_Float_Set *emsg;
-
-		  emsg = (Edje_Message_Float_Set *)em->msg;
-		  free(emsg);
-	       }
-	     break;
-	   case EDJE_MESSAGE_STRING_FLOAT:
-	       {
-		  Edje_Message_String_Float *emsg;
-
-		  emsg = (Edje_Message_String_Float *)em->msg;
-		  free(emsg->str);
-		  free(emsg);
-	       }
-	     break;
-	   case EDJE_MESSAGE_STRING_INT:
-	       {
-		  Edje_Message_String_Int *emsg;
-
-		  emsg = (Edje_Message_String_Int *)em->msg;
-		  free(emsg->str);
-		  free(emsg);
-	       }
-	     break;
-	   case EDJE_MESSAGE_STRING_FLOAT_SET:
-	       {
-		  Edje_Message_String_Float_Set *emsg;
-
-		  emsg = (Edje_Message_String_Float_Set *)em->msg;
-		  free(emsg->str);
-		  free(emsg);
-	       }
-	     break;
-	   case EDJE_MESSAGE_STRING_INT_SET:
-	       {
-		  Edje_Message_String_Int_Set *emsg;
-
-		  emsg = (Edje_Message_String_Int_Set *)em->msg;
-		  free(emsg->str);
-		  free(emsg);
-	       }
-	     break;
-	   case EDJE_MESSAGE_SIGNAL:
-	       {
-		  Edje_Message_Signal *emsg;
-
-		  emsg = (Edje_Message_Signal *)em->msg;
-		  if (emsg->sig) eina_stringshare_del(emsg->sig);
-		  if (emsg->src) eina_stringshare_del(emsg->src);
-                  if (emsg->data && (--(emsg->data->ref) == 0))
-                    {
-                       if (emsg->data->free_func)
-                         {
-                            emsg->data->free_func(emsg->data->data);
-                         }
-                       free(emsg->data);
-                    }
-		  free(emsg);
-	       }
-	     break;
-	   case EDJE_MESSAGE_STRING_SET:
-	       {
-		  Edje_Message_String_Set *emsg;
-
-		  emsg = (Edje_Message_String_Set *)em->msg;
-		  for (i = 0; i < emsg->count; i++)
-		    free(emsg->str[i]);
-		  free(emsg);
-	       }
-	     break;
-	   case EDJE_MESSAGE_NONE:
-	   default:
-	     break;
+	     Edje_Message_String_Float_Set *emsg2 = emsg;
+
+	     return sizeof (Edje_Message_String_Float_Set) +
+	       EDJE_MESSAGE_SET_EXTRA(emsg2->count, double) +
+	       strlen(emsg2->str) + 1;
 	  }
+      default:
+	return 0;
      }
-   free(em);
+}
+
+static char *
+_edje_message_str_pack(char **strs, const char *str)
+{
+   char *r = *strs;
+   size_t len;
+
+   len = strlen(str) + 1;
+   memcpy(r, str, len);
+   *strs += len;
+   return r;
 }
 
 void
 _edje_message_propornot_send(Edje *ed, Edje_Queue queue, Edje_Message_Type type, int id, void *emsg, Eina_Bool prop)
 {
-   /* FIXME: check all malloc & strdup fails and gracefully unroll and exit */
    Edje_Message *em;
+   char *strs;
    int i;
-   unsigned char *msg = NULL;
 
-   em = _edje_message_new(ed, queue, type, id);
+   em = _edje_message_new(ed, queue, type, id,
+                          _edje_message_payload_size(type, emsg));
    if (!em) return;
    em->propagated = prop;
-   if (_job)
-     {
-        ecore_job_del(_job);
-        _job = NULL;
-     }
-   if (_injob > 0)
+   /* only the first pending message schedules the flush, the others
+    * just join it */
+   if (!_ready_first)
      {
-        if (!_job_loss_timer)
-          _job_loss_timer = ecore_timer_add(0.001, _edje_job_loss_timer, NULL);
-     }
-   else
-     {
-        if (!_job)
-          {
-             _job = ecore_job_add(_edje_job, NULL);
-          }
-        if (_job_loss_timer)
-          {
-             ecore_timer_del(_job_loss_timer);
-             _job_loss_timer = NULL;
-          }
+        _queued_time = ecore_time_get();
+        _edje_message_schedule();
      }
+   /* copy the payload right after its struct, strings packed at the end */
    switch (em->type)
      {
       case EDJE_MESSAGE_NONE:
 	break;
       case EDJE_MESSAGE_SIGNAL:
+	_edje_message_signal_copy((Edje_Message_Signal *)em->msg,
+				  (Edje_Message_Signal *)emsg);
+	break;
+      case EDJE_MESSAGE_SIGNAL_SET:
 	  {
-	     Edje_Message_Signal *emsg2, *emsg3;
-
-	     emsg2 = (Edje_Message_Signal *)emsg;
-	     emsg3 = calloc(1, sizeof(Edje_Message_Signal));
-	     if (emsg2->sig) emsg3->sig = eina_stringshare_add(emsg2->sig);
-	     if (emsg2->src) emsg3->src = eina_stringshare_add(emsg2->src);
-	     if (emsg2->data)
-               {
-                  emsg3->data = emsg2->data;
-                  emsg3->data->ref++;
-               }
-	     msg = (unsigned char *)emsg3;
+	     Edje_Message_Signal_Set *emsg2, *emsg3;
+
+	     emsg2 = (Edje_Message_Signal_Set *)emsg;
+	     emsg3 = (Edje_Message_Signal_Set *)em->msg;
+	     emsg3->count = emsg2->count;
+	     for (i = 0; i < emsg3->count; i++)
+	       _edje_message_signal_copy(&emsg3->sig[i], &emsg2->sig[i]);
 	  }
 	break;
       case EDJE_MESSAGE_STRING:
@@ -404,66 +476,46 @@ _edje_message_propornot_send(Edje *ed, Edje_Queue queue, Edje_Message_Type type,
 	     Edje_Message_String *emsg2, *emsg3;
 
 	     emsg2 = (Edje_Message_String *)emsg;
-
-	     emsg3 = malloc(sizeof(Edje_Message_String));
-	     emsg3->str = strdup(emsg2->str);
-	     msg = (unsigned char *)emsg3;
+	     emsg3 = (Edje_Message_String *)em->msg;
+	     strs = (char *)(emsg3 + 1);
+	     emsg3->str = _edje_message_str_pack(&strs, emsg2->str);
 	  }
 	break;
       case EDJE_MESSAGE_INT:
-	  {
-	     Edje_Message_Int *emsg2, *emsg3;
-
-	     emsg2 = (Edje_Message_Int *)emsg;
-	     emsg3 = malloc(sizeof(Edje_Message_Int));
-	     emsg3->val = emsg2->val;
-	     msg = (unsigned char *)emsg3;
-	  }
+	*(Edje_Message_Int *)em->msg = *(Edje_Message_Int *)emsg;
 	break;
       case EDJE_MESSAGE_FLOAT:
-	  {
-	     Edje_Message_Float *emsg2, *emsg3;
-
-	     emsg2 = (Edje_Message_Float *)emsg;
-	     emsg3 = malloc(sizeof(Edje_Message_Float));
-	     emsg3->val = emsg2->val;
-	     msg = (unsigned char *)emsg3;
-	  }
+	*(Edje_Message_Float *)em->msg = *(Edje_Message_Float *)emsg;
 	break;
       case EDJE_MESSAGE_STRING_SET:
 	  {
 	     Edje_Message_String_Set *emsg2, *emsg3;
 
 	     emsg2 = (Edje_Message_String_Set *)emsg;
-	     emsg3 = malloc(sizeof(Edje_Message_String_Set) + ((emsg2->count - 1) * sizeof(char *)));
+	     emsg3 = (Edje_Message_String_Set *)em->msg;
+	     strs = (char *)em->msg + sizeof (Edje_Message_String_Set) +
+	       EDJE_MESSAGE_SET_EXTRA(emsg2->count, char *);
 	     emsg3->count = emsg2->count;
 	     for (i = 0; i < emsg3->count; i++)
-	       emsg3->str[i] = strdup(emsg2->str[i]);
-	     msg = (unsigned char *)emsg3;
+	       emsg3->str[i] = _edje_message_str_pack(&strs, emsg2->str[i]);
 	  }
 	break;
       case EDJE_MESSAGE_INT_SET:
 	  {
-	     Edje_Message_Int_Set *emsg2, *emsg3;
+	     Edje_Message_Int_Set *emsg2;
 
 	     emsg2 = (Edje_Message_Int_Set *)emsg;
-	     emsg3 = malloc(sizeof(Edje_Message_Int_Set) + ((emsg2->count - 1) * sizeof(int)));
-	     emsg3->count = emsg2->count;
-	     for (i = 0; i < emsg3->count; i++)
-	       emsg3->val[i] = emsg2->val[i];
-	     msg = (unsigned char *)emsg3;
+	     memcpy(em->msg, emsg2, sizeof (Edje_Message_Int_Set) +
+		    EDJE_MESSAGE_SET_EXTRA(emsg2->count, int));
 	  }
 	break;
       case EDJE_MESSAGE_FLOAT_SET:
 	  {
-	     Edje_Message_Float_Set *emsg2, *emsg3;
+	     Edje_Message_Float_Set *emsg2;
 
 	     emsg2 = (Edje_Message_Float_Set *)emsg;
-	     emsg3 = malloc(sizeof(Edje_Message_Float_Set) + ((emsg2->count - 1) * sizeof(double)));
-	     emsg3->count = emsg2->count;
-	     for (i = 0; i < emsg3->count; i++)
-	       emsg3->val[i] = emsg2->val[i];
-	     msg = (unsigned char *)emsg3;
+	     memcpy(em->msg, emsg2, sizeof (Edje_Message_Float_Set) +
+		    EDJE_MESSAGE_SET_EXTRA(emsg2->count, double));
 	  }
 	break;
       case EDJE_MESSAGE_STRING_INT:
@@ -471,10 +523,10 @@ _edje_message_propornot_send(Edje *ed, Edje_Queue queue, Edje_Message_Type type,
 	     Edje_Message_String_Int *emsg2, *emsg3;
 
 	     emsg2 = (Edje_Message_String_Int *)emsg;
-	     emsg3 = malloc(sizeof(Edje_Message_String_Int));
-	     emsg3->str = strdup(emsg2->str);
+	     emsg3 = (Edje_Message_String_Int *)em->msg;
+	     strs = (char *)(emsg3 + 1);
+	     emsg3->str = _edje_message_str_pack(&strs, emsg2->str);
 	     emsg3->val = emsg2->val;
-	     msg = (unsigned char *)emsg3;
 	  }
 	break;
       case EDJE_MESSAGE_STRING_FLOAT:
@@ -482,10 +534,10 @@ _edje_message_propornot_send(Edje *ed, Edje_Queue queue, Edje_Message_Type type,
 	     Edje_Message_String_Float *emsg2, *emsg3;
 
 	     emsg2 = (Edje_Message_String_Float *)emsg;
-	     emsg3 = malloc(sizeof(Edje_Message_String_Float));
-	     emsg3->str = strdup(emsg2->str);
+	     emsg3 = (Edje_Message_String_Float *)em->msg;
+	     strs = (char *)(emsg3 + 1);
+	     emsg3->str = _edje_message_str_pack(&strs, emsg2->str);
 	     emsg3->val = emsg2->val;
-	     msg = (unsigned char *)emsg3;
 	  }
 	break;
       case EDJE_MESSAGE_STRING_INT_SET:
@@ -493,12 +545,13 @@ _edje_message_propornot_send(Edje *ed, Edje_Queue queue, Edje_Message_Type type,
 	     Edje_Message_String_Int_Set *emsg2, *emsg3;
 
 	     emsg2 = (Edje_Message_String_Int_Set *)emsg;
-	     emsg3 = malloc(sizeof(Edje_Message_String_Int_Set) + ((emsg2->count - 1) * sizeof(int)));
-	     emsg3->str = strdup(emsg2->str);
+	     emsg3 = (Edje_Message_String_Int_Set *)em->msg;
+	     strs = (char *)em->msg + sizeof (Edje_Message_String_Int_Set) +
+	       EDJE_MESSAGE_SET_EXTRA(emsg2->count, int);
+	     emsg3->str = _edje_message_str_pack(&strs, emsg2->str);
 	     emsg3->count = emsg2->count;
 	     for (i = 0; i < emsg3->count; i++)
 	       emsg3->val[i] = emsg2->val[i];
-	     msg = (unsigned char *)emsg3;
 	  }
 	break;
       case EDJE_MESSAGE_STRING_FLOAT_SET:
@@ -506,20 +559,21 @@ _edje_message_propornot_send(Edje *ed, Edje_Queue queue, Edje_Message_Type type,
 	     Edje_Message_String_Float_Set *emsg2, *emsg3;
 
 	     emsg2 = (Edje_Message_String_Float_Set *)emsg;
-	     emsg3 = malloc(sizeof(Edje_Message_String_Float_Set) + ((emsg2->count - 1) * sizeof(double)));
-	     emsg3->str = strdup(emsg2->str);
+	     emsg3 = (Edje_Message_String_Float_Set *)em->msg;
+	     strs = (char *)em->msg + sizeof (Edje_Message_String_Float_Set) +
+	       EDJE_MESSAGE_SET_EXTRA(emsg2->count, double);
+	     emsg3->str = _edje_message_str_pack(&strs, emsg2->str);
 	     emsg3->count = emsg2->count;
 	     for (i = 0; i < emsg3->count; i++)
 	       emsg3->val[i] = emsg2->val[i];
-	     msg = (unsigned char *)emsg3;
 	  }
 	break;
       default:
 	break;
      }
 
-   em->msg = msg;
-   msgq = eina_list_append(msgq, em);
+   if (!_edje_message_push(ed, em))
+     _edje_message_free(em);
 }
 
 void
@@ -660,6 +714,17 @@ _edje_message_process(Edje_Message *em)
 			  em->propagated);
 	return;
      }
+   if (em->type == EDJE_MESSAGE_SIGNAL_SET)
+     {
+	Edje_Message_Signal_Set *emsg = (Edje_Message_Signal_Set *)em->msg;
+	int i;
+
+	/* in order, as if they had been emitted one by one */
+	for (i = 0; (i < emsg->count) && (!em->edje->delete_me); i++)
+	  _edje_emit_handle(em->edje, emsg->sig[i].sig, emsg->sig[i].src,
+			    emsg->sig[i].data, em->propagated);
+	return;
+     }
    /* if this has been queued up for the app then just call the callback */
    if (em->queue == EDJE_QUEUE_APP)
      {
@@ -725,63 +790,36 @@ _edje_message_process(Edje_Message *em)
 void
 _edje_message_queue_process(void)
 {
+   double t;
    int i;
 
-   if (!msgq) return;
+   if (!_ready_first) return;
+
+   t = ecore_time_get() - _queued_time;
+   if (t > _flush_latency_max) _flush_latency_max = t;
+   _flush_latency += t;
+   _flush_count++;
 
    /* allow the message queue to feed itself up to 8 times before forcing */
    /* us to go back to normal processing and let a 0 timeout deal with it */
-   for (i = 0; (i < 8) && (msgq); i++)
+   for (i = 0; (i < 8) && (_ready_first); i++)
      {
-	/* a temporary message queue */
-	if (tmp_msgq)
-	  {
-	     while (msgq)
-	       {
-		  tmp_msgq = eina_list_append(tmp_msgq, msgq->data);
-		  msgq = eina_list_remove_list(msgq, msgq);
-	       }
-	  }
-	else
-	  {
-	     tmp_msgq = msgq;
-	     msgq = NULL;
-	  }
+        unsigned int n;
 
-        tmp_msgq_processing++;
-	while (tmp_msgq)
-	  {
-	     Edje_Message *em;
-	     Edje *ed;
-
-	     em = tmp_msgq->data;
-	     ed = em->edje;
-	     tmp_msgq = eina_list_remove_list(tmp_msgq, tmp_msgq);
-	     em->edje->message.num--;
-	     if (!ed->delete_me)
-	       {
-		  ed->processing_messages++;
-		  _edje_message_process(em);
-		  _edje_message_free(em);
-		  ed->processing_messages--;
-	       }
-	     else
-	       _edje_message_free(em);
-	     if (ed->processing_messages == 0)
-	       {
-		  if (ed->delete_me) _edje_del(ed);
-	       }
-	  }
-        tmp_msgq_processing--;
-        if (tmp_msgq_processing == 0)
-           tmp_msgq_restart = 0;
-        else
-           tmp_msgq_restart = 1;
+        /* objects getting messages from now on go to the next pass */
+        for (n = _ready_count; (n > 0) && (_ready_first); n--)
+          {
+             Edje *ed;
+
+             ed = _ready_first;
+             _edje_message_ready_del(ed);
+             _edje_message_flush(ed, ed->message.num);
+          }
      }
 
    /* if the message queue filled again set a timer to expire in 0.0 sec */
    /* to get the idle enterer to be run again */
-   if (msgq)
+   if (_ready_first)
      {
         static int self_feed_debug = -1;
         
@@ -796,70 +834,29 @@ _edje_message_queue_process(void)
              WRN("Edje is in a self-feeding message loop (> 8 loops needed)");
           }
 	ecore_timer_add(0.0, _edje_dummy_timer, NULL);
+        /* the leftovers did not go through an empty queue, schedule them */
+        _queued_time = ecore_time_get();
+        _edje_message_schedule();
      }
 }
 
 void
 _edje_message_queue_clear(void)
 {
-   while (msgq)
-     {
-	Edje_Message *em;
-
-	em = msgq->data;
-	msgq = eina_list_remove_list(msgq, msgq);
-	em->edje->message.num--;
-	_edje_message_free(em);
-     }
-   while (tmp_msgq)
-     {
-	Edje_Message *em;
-
-	em = tmp_msgq->data;
-	tmp_msgq = eina_list_remove_list(tmp_msgq, tmp_msgq);
-	em->edje->message.num--;
-	_edje_message_free(em);
-     }
+   while (_ready_first)
+     _edje_message_del(_ready_first);
 }
 
 void
 _edje_message_del(Edje *ed)
 {
-   Eina_List *l;
-
-   if (ed->message.num <= 0) return;
-   /* delete any messages on the main queue for this edje object */
-   for (l = msgq; l; )
-     {
-	Edje_Message *em;
-	Eina_List *lp;
-
-	em = eina_list_data_get(l);
-	lp = l;
-	l = eina_list_next(l);
-	if (em->edje == ed)
-	  {
-	     msgq = eina_list_remove_list(msgq, lp);
-	     em->edje->message.num--;
-	     _edje_message_free(em);
-	  }
-	if (ed->message.num <= 0) return;
-     }
-   /* delete any on the processing queue */
-   for (l = tmp_msgq; l; )
-     {
-	Edje_Message *em;
-	Eina_List *lp;
+   Edje_Message *em;
 
-	em = eina_list_data_get(l);
-	lp = l;
-	l = eina_list_next(l);
-	if (em->edje == ed)
-	  {
-	     tmp_msgq = eina_list_remove_list(tmp_msgq, lp);
-	     em->edje->message.num--;
-	     _edje_message_free(em);
-	  }
-	if (ed->message.num <= 0) return;
-     }
+   _edje_message_ready_del(ed);
+   while ((em = _edje_message_pop(ed)))
+     _edje_message_free(em);
+   free(ed->message.queue);
+   ed->message.queue = NULL;
+   ed->message.first = 0;
+   ed->message.size = 0;
 }
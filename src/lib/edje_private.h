@@ -299,6 +299,7 @@ typedef struct _Edje_Program                         Edje_Program;
 typedef struct _Edje_Program_Target                  Edje_Program_Target;
 typedef struct _Edje_Program_After                   Edje_Program_After;
 typedef struct _Edje_Part_Collection_Directory_Entry Edje_Part_Collection_Directory_Entry;
+typedef struct _Edje_Collection_Preload              Edje_Collection_Preload;
 typedef struct _Edje_Pack_Element                    Edje_Pack_Element;
 typedef struct _Edje_Part_Collection                 Edje_Part_Collection;
 typedef struct _Edje_Part                            Edje_Part;
@@ -320,15 +321,23 @@ typedef struct _Edje_Part_Description_Spec_Text      Edje_Part_Description_Spec_
 typedef struct _Edje_Part_Description_Spec_Box       Edje_Part_Description_Spec_Box;
 typedef struct _Edje_Part_Description_Spec_Table     Edje_Part_Description_Spec_Table;
 typedef struct _Edje_Patterns                        Edje_Patterns;
+typedef struct _Edje_Match_Dfa                       Edje_Match_Dfa;
+typedef struct _Edje_Program_Cache_Entry             Edje_Program_Cache_Entry;
+typedef struct _Edje_Signal_Route                    Edje_Signal_Route;
 typedef struct _Edje_Part_Box_Animation              Edje_Part_Box_Animation;
 typedef struct _Edje_Part_Limit                      Edje_Part_Limit;
+typedef struct _Edje_Part_Order                      Edje_Part_Order;
 
 typedef struct _Edje Edje;
 typedef struct _Edje_Real_Part_State Edje_Real_Part_State;
 typedef struct _Edje_Real_Part_Drag Edje_Real_Part_Drag;
 typedef struct _Edje_Real_Part_Set Edje_Real_Part_Set;
+typedef struct _Edje_Real_Part_Text Edje_Real_Part_Text;
+typedef struct _Edje_Real_Part_Container Edje_Real_Part_Container;
+typedef struct _Edje_Real_Part_Swallow Edje_Real_Part_Swallow;
 typedef struct _Edje_Real_Part Edje_Real_Part;
 typedef struct _Edje_Running_Program Edje_Running_Program;
+typedef struct _Edje_Tween_Lut Edje_Tween_Lut;
 typedef struct _Edje_Signal_Callback Edje_Signal_Callback;
 typedef struct _Edje_Calc_Params Edje_Calc_Params;
 typedef struct _Edje_Pending_Program Edje_Pending_Program;
@@ -447,8 +456,12 @@ typedef struct _Edje_Markup_Filter_Callback Edje_Markup_Filter_Callback;
 
 struct _Edje_File
 {
+   EINA_INLIST; /* in the file cache while unreferenced */
    const char                     *path;
    time_t                          mtime;
+   size_t                          size; /* of the file on disk */
+   size_t                          cache_bytes; /* charged to the file cache */
+   double                          checked_at; /* when mtime was last compared to the disk */
 
    Edje_External_Directory        *external_dir;
    Edje_Image_Directory           *image_dir;
@@ -466,7 +479,9 @@ struct _Edje_File
    Eina_Hash			  *fonts;
 
    Eina_Hash			  *collection;
-   Eina_List			  *collection_cache;
+   Eina_Inlist			  *collection_cache; /* unreferenced collections, most recently used first */
+   unsigned int                    collection_cache_count;
+   size_t                          collection_cache_bytes;
 
    Edje_Patterns		  *collection_patterns;
 
@@ -482,6 +497,8 @@ struct _Edje_File
    unsigned char                   free_strings : 1;
    unsigned char                   dangling : 1;
    unsigned char		   warning : 1;
+   unsigned char                   changed : 1; /* reported changed, check it on next use */
+   unsigned char                   cached : 1; /* unreferenced, in the file cache */
 };
 
 struct _Edje_Style
@@ -630,6 +647,10 @@ struct _Edje_Program /* a conditional program to be run */
       FLOAT_T  v1; /* other value for drag actions */
       FLOAT_T  v2; /* other value for drag actions */
    } tween;
+   Edje_Tween_Lut *tween_lut; /* sampled tween curve, built on the first run */
+   int         timeline_next; /* id + 1 of the program this tween hands its run over to, 0 if none */
+   unsigned int timeline_walk; /* the timeline walk timeline_entered belongs to */
+   double      timeline_entered; /* when that walk entered this step */
 
    Eina_List  *targets; /* list of target parts to apply the state to */
 
@@ -703,6 +724,8 @@ struct _Edje_Part_Collection_Directory_Entry
    } mp_rtl; /* For Right To Left interface */
 
    Edje_Part_Collection *ref;
+   Edje_Part_Collection *cached; /* unreferenced, in the file collection cache */
+   Edje_Collection_Preload *preload; /* pending edje_file_collection_preload() */
 };
 
 /*----------*/
@@ -743,10 +766,18 @@ struct _Edje_Part_Limit
    Edje_Part_Limit_State height; /* -1, 0, or 1 */
 };
 
+struct _Edje_Part_Order
+{
+   int part;
+};
+
 /*----------*/
 
 struct _Edje_Part_Collection
 {
+   EINA_INLIST; /* in the file collection cache while unreferenced */
+   size_t cache_bytes; /* estimated memory charged to the collection cache */
+
    struct { /* list of Edje_Program */
       Edje_Program **fnmatch; /* complex match with "*?[\" */
       unsigned int fnmatch_count;
@@ -778,6 +809,11 @@ struct _Edje_Part_Collection
    Edje_Part **parts; /* an array of Edje_Part */
    unsigned int parts_count;
 
+   struct { /* computed by edje_cc, every part comes after the parts it depends on */
+      Edje_Part_Order *parts;
+      unsigned int parts_count;
+   } recalc_order;
+
    Eina_Hash *data;
 
    int        id; /* the collection id */
@@ -785,6 +821,25 @@ struct _Edje_Part_Collection
    Eina_Hash *alias; /* aliasing part */
    Eina_Hash *aliased; /* invert match of alias */
 
+   Eina_Hash *part_names; /* part name -> Edje_Part, shared by all Edje of this group */
+   Eina_Hash *signal_routes; /* "part:" prefix of forwarded signals -> Edje_Signal_Route */
+
+   struct {
+      unsigned int *index; /* parts_count + 1 offsets into list */
+      unsigned int *list; /* ids of the parts depending on each part */
+   } dependents;
+
+   Eina_Hash *size_min_cache; /* memoized edje_object_size_min_restricted_calc() results */
+
+   struct { /* programs needing a glob match, shared by all Edje of this group */
+      Edje_Program **globing;
+      unsigned int globing_count;
+      Edje_Match_Dfa *signals;
+      Edje_Match_Dfa *sources;
+      unsigned int generation; /* bumped when the programs change */
+      Eina_Bool timelines : 1; /* Edje_Program.timeline_next are set */
+   } patterns;
+
    struct {
       Edje_Size min, max;
       unsigned char orientation;
@@ -792,12 +847,11 @@ struct _Edje_Part_Collection
 
    int        references;
 
-#ifdef EDJE_PROGRAM_CACHE
-   struct {
-      Eina_Hash                   *no_matches;
-      Eina_Hash                   *matches;
+   struct { /* the programs matched by the last emitted signal, source pairs */
+      Edje_Program_Cache_Entry   **buckets;
+      Eina_Inlist                 *lru; /* most recently used first */
+      unsigned int                 count;
    } prog_cache;
-#endif
 
    Embryo_Program   *script; /* all the embryo script code for this group */
    const char       *part;
@@ -842,6 +896,18 @@ struct _Edje_Part_Description_List
    unsigned int desc_count;
 };
 
+/* open addressing table from (state name, value) to a position in
+ * Edje_Part_Description_List.desc, keyed by the name pointer as all the
+ * names of an edje file come from the same string dictionary */
+typedef struct _Edje_Part_Description_Index Edje_Part_Description_Index;
+struct _Edje_Part_Description_Index
+{
+   Edje_Part_Description_Common **desc; /* the list it was built for */
+   unsigned int desc_count;
+   unsigned int mask;
+   unsigned int slots[1]; /* position in desc + 1, 0 when empty */
+};
+
 struct _Edje_Part
 {
    const char                   *name; /* the name if any of the part */
@@ -849,6 +915,7 @@ struct _Edje_Part
    Edje_Part_Description_Common *default_desc_rtl; /* default desc for Right To Left interface */
 
    Edje_Part_Description_List    other; /* other possible descriptors */
+   Edje_Part_Description_Index  *other_index; /* built on the first lookup */
 
    const char           *source, *source2, *source3, *source4, *source5, *source6;
    int                    id; /* its id number */
@@ -1083,18 +1150,15 @@ struct _Edje_Signal_Source_Char
 struct _Edje_Signals_Sources_Patterns
 
 {
-   Edje_Patterns *signals_patterns;
-   Edje_Patterns *sources_patterns;
+   Edje_Match_Dfa *signals_patterns;
+   Edje_Match_Dfa *sources_patterns;
 
    Eina_Rbtree   *exact_match;
 
    union {
       struct {
-	 Edje_Program **globing;
-	 unsigned int  count;
-      } programs;
-      struct {
-	 Eina_List     *globing;
+	 Edje_Signal_Callback **globing;
+	 unsigned int          count;
       } callbacks;
    } u;
 };
@@ -1119,7 +1183,7 @@ struct _Edje
    Evas_Object          *obj; /* the smart object */
    Edje_File            *file; /* the file the data comes form */
    Edje_Part_Collection *collection; /* the description being used */
-   Eina_List            *actions; /* currently running actions */
+   Edje_Running_Program **actions; /* currently running actions, in start order */
    Eina_List            *callbacks;
    Eina_List            *pending_actions;
    Eina_List            *color_classes;
@@ -1137,6 +1201,8 @@ struct _Edje
 
    int                   table_programs_size;
    unsigned int          table_parts_size;
+   unsigned int          actions_count, actions_size;
+   unsigned int          animator_index; /* slot in _edje_animators while animating */
 
    struct {
       Eina_Hash         *text_class;
@@ -1148,6 +1214,7 @@ struct _Edje
    struct {
       Edje_Signals_Sources_Patterns callbacks;
       Edje_Signals_Sources_Patterns programs;
+      unsigned int programs_generation; /* of the collection programs */
    } patterns;
 
    int                   references;
@@ -1165,7 +1232,10 @@ struct _Edje
    struct {
       Edje_Message_Handler_Cb  func;
       void                    *data;
-      int                      num;
+      struct _Edje_Message   **queue; /* ring buffer of pending messages, size is a power of 2 */
+      unsigned int             first, num, size;
+      Edje                    *ready_prev, *ready_next; /* in the list of objects with pending messages */
+      Eina_Bool                ready : 1;
    } message;
    int                   processing_messages;
 
@@ -1186,7 +1256,14 @@ struct _Edje
 
    int                   walking_callbacks;
 
+   struct {
+      unsigned int       hits;
+      unsigned int       misses;
+      unsigned int       bytes;
+   } calc_cache_stats;
+
    unsigned int          dirty : 1;
+   unsigned int          partial_dirty : 1; /* only parts flagged dirty need a recalc */
    unsigned int          recalc : 1;
    unsigned int          delete_callbacks : 1;
    unsigned int          just_added_callbacks : 1;
@@ -1195,16 +1272,17 @@ struct _Edje
    unsigned int          no_anim : 1;
    unsigned int          calc_only : 1;
    unsigned int          walking_actions : 1;
+   unsigned int          animation_lod : 2; /* an Edje_Animation_Lod */
    unsigned int          block_break : 1;
    unsigned int          delete_me : 1;
    unsigned int          postponed : 1;
    unsigned int          freeze_calc : 1;
    unsigned int          has_entries : 1;
    unsigned int          entries_inited : 1;
-#ifdef EDJE_CALC_CACHE
    unsigned int          text_part_change : 1;
    unsigned int          all_part_change : 1;
-#endif
+   unsigned int          calc_cache : 1; /* keep the params of each part state between recalc */
+   unsigned int          size_min_cache : 1; /* share min size results with the other objects of the group */
    unsigned int          have_mapped_part : 1;
    unsigned int          recalc_call : 1;
    unsigned int          update_hints : 1;
@@ -1279,14 +1357,11 @@ struct _Edje_Real_Part_State
    Edje_Real_Part        *rel1_to_y; // 4
    Edje_Real_Part        *rel2_to_x; // 4
    Edje_Real_Part        *rel2_to_y; // 4
-#ifdef EDJE_CALC_CACHE
    int                    state; // 4
-   Edje_Calc_Params       p; // 96
-#endif
+   Edje_Calc_Params      *p; // 4 only allocated by the calc cache
    void                  *external_params; // 4
    Edje_Real_Part_Set    *set; // 4
-}; // 32
-// WITH EDJE_CALC_CACHE 132
+}; // 40
 
 struct _Edje_Real_Part_Drag
 {
@@ -1303,6 +1378,47 @@ struct _Edje_Real_Part_Drag
    Edje_Real_Part       *confine_to; // 4
 }; // 104
 
+#define EDJE_RP_TYPE_NONE      0
+#define EDJE_RP_TYPE_TEXT      1 /* TEXT and TEXTBLOCK */
+#define EDJE_RP_TYPE_CONTAINER 2 /* BOX and TABLE */
+#define EDJE_RP_TYPE_SWALLOW   3 /* SWALLOW, GROUP and EXTERNAL */
+
+struct _Edje_Real_Part_Text
+{
+   Edje_Real_Part        *source; // 4
+   Edje_Real_Part        *text_source; // 4
+   const char            *text; // 4
+   Edje_Position          offset; // 8 text only
+   const char            *font; // 4 text only
+   const char            *style; // 4 text only
+   int                    size; // 4 text only
+   struct {
+      double              in_w, in_h; // 16 text only
+      int                 in_size; // 4 text only
+      const char         *in_str; // 4 text only
+      const char         *out_str; // 4 text only
+      int                 out_size; // 4 text only
+      FLOAT_T             align_x, align_y; // 16 text only
+      double              elipsis; // 8 text only
+      int                 fit_x, fit_y; // 8 text only
+   } cache; // 64
+}; // 100
+
+struct _Edje_Real_Part_Container
+{
+   Eina_List                *items; // 4
+   Edje_Part_Box_Animation  *anim; // 4 box only
+}; // 8
+
+struct _Edje_Real_Part_Swallow
+{
+   Evas_Object              *swallowed_object; // 4
+   struct {
+      Edje_Size min, max; // 16
+      Edje_Aspect aspect; // 12
+   } swallow_params; // 28
+}; // 32
+
 struct _Edje_Real_Part
 {
    Edje                     *edje; // 4
@@ -1311,51 +1427,23 @@ struct _Edje_Real_Part
    int                       x, y, w, h; // 16
    Edje_Rectangle            req; // 16
 
-   Eina_List                *items; // 4 //FIXME: only if table/box
-   Edje_Part_Box_Animation  *anim; // 4 //FIXME: Used only if box
-   void                     *entry_data; // 4 // FIXME: move to entry section
-
-   Evas_Object              *swallowed_object; // 4 // FIXME: move with swallow_params data
-   struct {
-      Edje_Size min, max; // 16
-      Edje_Aspect aspect; // 12
-   } swallow_params; // 28 // FIXME: only if type SWALLOW
+   union {
+      Edje_Real_Part_Text      *text;
+      Edje_Real_Part_Container *container;
+      Edje_Real_Part_Swallow   *swallow;
+   } typedata; // 4 allocated along the part, depends on type
 
    Edje_Real_Part_Drag      *drag; // 4
    Edje_Real_Part	    *events_to; // 4
-
-   struct {
-      Edje_Real_Part        *source; // 4
-      Edje_Real_Part        *text_source; // 4
-      const char            *text; // 4
-      Edje_Position          offset; // 8 text only
-      const char	    *font; // 4 text only
-      const char	    *style; // 4 text only
-      int                    size; // 4 text only
-      struct {
-	 double              in_w, in_h; // 16 text only
-	 int                 in_size; // 4 text only
-	 const char	    *in_str; // 4 text only
-	 const char         *out_str; // 4 text only
-	 int                 out_size; // 4 text only
-	 FLOAT_T             align_x, align_y; // 16 text only
-	 double              elipsis; // 8 text only
-	 int                 fit_x, fit_y; // 8 text only
-      } cache; // 64
-   } text; // 86 // FIXME make text a potiner to struct and alloc at end
-                 // if part type is TEXT move common members textblock +
-                 // text to front and have smaller struct for textblock
+   void                     *entry_data; // 4 entry_mode parts only
 
    FLOAT_T                   description_pos; // 8
    Edje_Part_Description_Common *chosen_description; // 4
-   Edje_Real_Part_State      param1; // 20
-   // WITH EDJE_CALC_CACHE: 140
+   Edje_Real_Part_State      param1; // 40
    Edje_Real_Part_State     *param2, *custom; // 8
    Edje_Calc_Params         *current; // 4
 
-#ifdef EDJE_CALC_CACHE
    int                       state; // 4
-#endif
 
    Edje_Real_Part           *clip_to; // 4
 
@@ -1363,15 +1451,23 @@ struct _Edje_Real_Part
 
    int                       clicked_button; // 4
 
+   unsigned char             type; // 1 EDJE_RP_TYPE_*
    unsigned char             calculated; // 1
    unsigned char             calculating; // 1
 
    unsigned char             still_in   : 1; // 1
-#ifdef EDJE_CALC_CACHE
+   unsigned char             dirty      : 1; // 0
    unsigned char             invalidate : 1; // 0
-#endif
-}; //  264
-// WITH EDJE_CALC_CACHE: 404
+}; //  144
+
+#define EDJE_TWEEN_LUT_SIZE 512
+
+struct _Edje_Tween_Lut
+{
+   int             mode; /* the curve and parameters it was sampled for */
+   FLOAT_T         v1, v2;
+   FLOAT_T         pos[EDJE_TWEEN_LUT_SIZE + 1];
+};
 
 struct _Edje_Running_Program
 {
@@ -1529,19 +1625,31 @@ struct _Edje_Message_Signal_Data
 
 struct _Edje_Message_Signal
 {
+   /* stringshares, messages only take a reference on them */
    const char *sig;
    const char *src;
    Edje_Message_Signal_Data *data;
 };
 
+/* a batch of signals emitted to one object at once, internal only */
+#define EDJE_MESSAGE_SIGNAL_SET ((Edje_Message_Type)(EDJE_MESSAGE_STRING_FLOAT_SET + 1))
+
+typedef struct _Edje_Message_Signal_Set Edje_Message_Signal_Set;
+struct _Edje_Message_Signal_Set
+{
+   int count;
+   Edje_Message_Signal sig[1];
+};
+
 struct _Edje_Message
 {
    Edje              *edje;
    Edje_Queue         queue;
    Edje_Message_Type  type;
    int                id;
-   unsigned char     *msg;
+   unsigned char     *msg; /* payload, allocated along the message */
    Eina_Bool          propagated : 1;
+   Eina_Bool          pooled : 1;
 };
 
 typedef enum _Edje_Fill
@@ -1620,38 +1728,41 @@ struct _Edje_User_Defined
 };
 
 Edje_Patterns   *edje_match_collection_dir_init(const Eina_List *lst);
-Edje_Patterns   *edje_match_programs_signal_init(Edje_Program * const *array,
-						 unsigned int count);
-Edje_Patterns   *edje_match_programs_source_init(Edje_Program * const *array,
-						 unsigned int count);
-Edje_Patterns   *edje_match_callback_signal_init(const Eina_List *lst);
-Edje_Patterns   *edje_match_callback_source_init(const Eina_List *lst);
+Edje_Match_Dfa  *edje_match_programs_signal_dfa_new(Edje_Program * const *array,
+						   unsigned int count);
+Edje_Match_Dfa  *edje_match_programs_source_dfa_new(Edje_Program * const *array,
+						   unsigned int count);
+Edje_Match_Dfa  *edje_match_callback_signal_dfa_new(Edje_Signal_Callback * const *array,
+						   unsigned int count);
+Edje_Match_Dfa  *edje_match_callback_source_dfa_new(Edje_Signal_Callback * const *array,
+						   unsigned int count);
 
 Eina_Bool        edje_match_collection_dir_exec(const Edje_Patterns      *ppat,
 						const char               *string);
-Eina_Bool        edje_match_programs_exec(const Edje_Patterns    *ppat_signal,
-					  const Edje_Patterns    *ppat_source,
+Eina_Bool        edje_match_programs_exec(Edje_Match_Dfa         *dfa_signal,
+					  Edje_Match_Dfa         *dfa_source,
 					  const char             *signal,
 					  const char             *source,
 					  Edje_Program          **programs,
 					  Eina_Bool (*func)(Edje_Program *pr, void *data),
-					  void                   *data,
-                                          Eina_Bool               prop);
-int              edje_match_callback_exec(Edje_Patterns          *ppat_signal,
-					  Edje_Patterns          *ppat_source,
+					  void                   *data);
+int              edje_match_callback_exec(Edje_Match_Dfa         *dfa_signal,
+					  Edje_Match_Dfa         *dfa_source,
 					  const char             *signal,
 					  const char             *source,
-					  Eina_List              *callbacks,
+					  Edje_Signal_Callback  **callbacks,
 					  Edje                   *ed,
                                           Eina_Bool               prop);
 
 void             edje_match_patterns_free(Edje_Patterns *ppat);
+void             edje_match_dfa_free(Edje_Match_Dfa *dfa);
 
 Eina_List *edje_match_program_hash_build(Edje_Program * const * programs,
 					 unsigned int count,
 					 Eina_Rbtree **tree);
-Eina_List *edje_match_callback_hash_build(const Eina_List *callbacks,
-					  Eina_Rbtree **tree);
+Edje_Signal_Callback **edje_match_callback_hash_build(const Eina_List *callbacks,
+						      unsigned int *count,
+						      Eina_Rbtree **tree);
 const Eina_List *edje_match_signal_source_hash_get(const char *signal,
 						   const char *source,
 						   const Eina_Rbtree *tree);
@@ -1667,11 +1778,13 @@ EAPI extern Eina_Bool _on_edjecc;
 
 extern int              _edje_anim_count;
 extern Ecore_Animator  *_edje_timer;
-extern Eina_List       *_edje_animators;
+extern Edje           **_edje_animators;
+extern unsigned int     _edje_animators_count;
 extern Eina_List       *_edje_edjes;
 
 extern char            *_edje_fontset_append;
 extern FLOAT_T          _edje_scale;
+extern unsigned int     _edje_font_generation;
 extern int              _edje_freeze_val;
 extern int              _edje_freeze_calc_count;
 extern Eina_List       *_edje_freeze_calc_list;
@@ -1696,12 +1809,21 @@ extern Eina_Mempool *_emp_SPACER;
 extern Eina_Mempool *_emp_part;
 
 void  _edje_part_pos_set(Edje *ed, Edje_Real_Part *ep, int mode, FLOAT_T pos, FLOAT_T v1, FLOAT_T v2);
+void  _edje_part_tween_pos_set(Edje *ed, Edje_Real_Part *ep, FLOAT_T npos);
+FLOAT_T _edje_tween_pos_map(int mode, FLOAT_T pos, FLOAT_T v1, FLOAT_T v2);
+FLOAT_T _edje_program_tween_pos(Edje_Program *pr, FLOAT_T pos);
 Edje_Part_Description_Common *_edje_part_description_find(Edje *ed,
 							  Edje_Real_Part *rp,
 							  const char *name, double val);
 void  _edje_part_description_apply(Edje *ed, Edje_Real_Part *ep, const char  *d1, double v1, const char *d2, double v2);
 void  _edje_recalc(Edje *ed);
 void  _edje_recalc_do(Edje *ed);
+void  _edje_part_dirty_set(Edje *ed, Edje_Real_Part *ep);
+void  _edje_calc_cache_state_clean(Edje *ed, Edje_Real_Part_State *st);
+Eina_Bool _edje_real_part_typedata_new(Edje_Real_Part *rp);
+void  _edje_real_part_typedata_free(Edje_Real_Part *rp);
+void  _edje_collection_dependents_build(Edje_Part_Collection *edc);
+void  _edje_collection_dependents_clean(Edje_Part_Collection *edc);
 void  _edje_part_recalc_1(Edje *ed, Edje_Real_Part *ep);
 int   _edje_part_dragable_calc(Edje *ed, Edje_Real_Part *ep, FLOAT_T *x, FLOAT_T *y);
 void  _edje_dragable_pos_set(Edje *ed, Edje_Real_Part *ep, FLOAT_T x, FLOAT_T y);
@@ -1722,6 +1844,7 @@ void  _edje_file_add(Edje *ed);
 void  _edje_file_del(Edje *ed);
 void  _edje_file_free(Edje_File *edf);
 void  _edje_file_cache_shutdown(void);
+void  _edje_object_file_async_shutdown(void);
 void  _edje_collection_free(Edje_File *edf,
 			    Edje_Part_Collection *ec,
 			    Edje_Part_Collection_Directory_Entry *ce);
@@ -1745,9 +1868,24 @@ void  _edje_unref(Edje *ed);
 
 Eina_Bool _edje_program_run_iterate(Edje_Running_Program *runp, double tim);
 void  _edje_program_end(Edje *ed, Edje_Running_Program *runp);
+Eina_Bool _edje_running_program_add(Edje *ed, Edje_Running_Program *runp);
+void  _edje_running_program_del(Edje *ed, Edje_Running_Program *runp);
+void  _edje_running_programs_end(Edje *ed, int program_id);
+void  _edje_running_programs_compact(Edje *ed);
+void  _edje_running_programs_free(Edje *ed);
+unsigned int _edje_animators_walk_begin(void);
+Eina_Bool _edje_animator_skip(Edje *ed, unsigned int tick);
+void  _edje_animators_walk_end(void);
 void  _edje_program_run(Edje *ed, Edje_Program *pr, Eina_Bool force, const char *ssig, const char *ssrc);
 void _edje_programs_patterns_clean(Edje *ed);
 void _edje_programs_patterns_init(Edje *ed);
+void _edje_programs_timelines_init(Edje *ed);
+void _edje_collection_patterns_build(Edje_Part_Collection *edc);
+void _edje_collection_programs_patterns_clean(Edje_Part_Collection *edc);
+void _edje_collection_program_cache_clean(Edje_Part_Collection *edc);
+void _edje_collection_program_cache_trim(Edje_Part_Collection *edc);
+void _edje_cache_program_cache_trim_all(void);
+void _edje_collection_signal_routes_clean(Edje_Part_Collection *edc);
 void  _edje_emit(Edje *ed, const char *sig, const char *src);
 void _edje_emit_full(Edje *ed, const char *sig, const char *src, void *data, void (*free_func)(void *));
 void _edje_emit_handle(Edje *ed, const char *sig, const char *src, Edje_Message_Signal_Data *data, Eina_Bool prop);
@@ -1768,6 +1906,9 @@ const char *   _edje_text_class_font_get(Edje *ed,
 
 
 Edje_Real_Part   *_edje_real_part_get(const Edje *ed, const char *part);
+void              _edje_collection_part_names_build(Edje_Part_Collection *edc);
+void              _edje_collection_part_names_clean(Edje_Part_Collection *edc);
+void              _edje_collection_size_min_clean(Edje_Part_Collection *edc);
 Edje_Real_Part   *_edje_real_part_recursive_get(const Edje *ed, const char *part);
 Edje_Color_Class *_edje_color_class_find(Edje *ed, const char *color_class);
 void              _edje_color_class_member_direct_del(const char *color_class, void *lookup);
@@ -1878,7 +2019,7 @@ void          _edje_var_anim_del            (Edje *ed, int id);
 void          _edje_message_init            (void);
 void          _edje_message_shutdown        (void);
 void          _edje_message_cb_set          (Edje *ed, void (*func) (void *data, Evas_Object *obj, Edje_Message_Type type, int id, void *msg), void *data);
-Edje_Message *_edje_message_new             (Edje *ed, Edje_Queue queue, Edje_Message_Type type, int id);
+Edje_Message *_edje_message_new             (Edje *ed, Edje_Queue queue, Edje_Message_Type type, int id, size_t size);
 void          _edje_message_free            (Edje_Message *em);
 void          _edje_message_propornot_send  (Edje *ed, Edje_Queue queue, Edje_Message_Type type, int id, void *emsg, Eina_Bool prop);
 void          _edje_message_send            (Edje *ed, Edje_Queue queue, Edje_Message_Type type, int id, void *emsg);
@@ -1897,7 +2038,11 @@ Edje_File *_edje_cache_file_coll_open(const char *file, const char *coll, int *e
 void _edje_cache_coll_clean(Edje_File *edf);
 void _edje_cache_coll_flush(Edje_File *edf);
 void _edje_cache_coll_unref(Edje_File *edf, Edje_Part_Collection *edc);
+void _edje_cache_coll_insert(Edje_File *edf, Edje_Part_Collection *edc);
+void _edje_cache_coll_remove(Edje_File *edf, Edje_Part_Collection *edc);
 void _edje_cache_file_unref(Edje_File *edf);
+int  _edje_cache_file_check(Edje_File *edf);
+const void *_edje_file_data_get(Edje_File *edf, const char *key, int *size, void **copy);
 
 void _edje_embryo_globals_init(Edje *ed);
 
@@ -2122,7 +2267,7 @@ void _edje_lua2_error_full(const char *file, const char *fnc, int line, lua_Stat
 #define _edje_lua2_error(L, err_code) _edje_lua2_error_full(__FILE__, __FUNCTION__, __LINE__, L, err_code)
 void _edje_lua2_script_init(Edje *ed);
 void _edje_lua2_script_shutdown(Edje *ed);
-void _edje_lua2_script_load(Edje_Part_Collection *edc, void *data, int size);
+void _edje_lua2_script_load(Edje_Part_Collection *edc, const void *data, int size);
 void _edje_lua2_script_unload(Edje_Part_Collection *edc);
 
 void _edje_lua2_script_func_shutdown(Edje *ed);
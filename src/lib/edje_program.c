@@ -3,16 +3,97 @@
 static void _edje_emit_cb(Edje *ed, const char *sig, const char *src, Edje_Message_Signal_Data *data, Eina_Bool prop);
 static void _edje_param_copy(Edje_Real_Part *src_part, const char *src_param, Edje_Real_Part *dst_part, const char *dst_param);
 static void _edje_param_set(Edje_Real_Part *part, const char *param, const char *value);
+static Eina_Bool _edje_emit_forward(Edje *ed, const char *sig, const char *src);
 
 int             _edje_anim_count = 0;
 Ecore_Animator *_edje_timer = NULL;
-Eina_List      *_edje_animators = NULL;
+/* flat array of the objects with running programs, walked by the single
+ * global animator without allocating */
+Edje          **_edje_animators = NULL;
+unsigned int    _edje_animators_count = 0;
+static unsigned int _edje_animators_size = 0;
+static Eina_Bool    _edje_animators_walking = EINA_FALSE;
+static Eina_Bool    _edje_animators_holes = EINA_FALSE;
+
+static Eina_Bool    _edje_animation_lod = EINA_FALSE;
+static Evas_Coord   _edje_animation_lod_size = 32;
+static unsigned int _edje_animation_lod_divisor = 4;
+
+/* bumped on every timeline walk, Edje_Program.timeline_walk holds the
+ * walk that last stamped the step */
+static unsigned int _edje_timeline_walk = 0;
+
+/* signal, source pairs recently emitted on a group, with the programs
+ * they matched, the key strings are stringshares compared by pointer */
+#define EDJE_PROGRAM_CACHE_BUCKETS 64
+
+struct _Edje_Program_Cache_Entry
+{
+   EINA_INLIST;
+   Edje_Program_Cache_Entry *bucket_next;
+   const char               *signal;
+   const char               *source;
+   unsigned int              count;
+   Edje_Program             *programs[1];
+};
+
+static int          _edje_program_cache_size = 32;
+static unsigned int _edje_program_cache_hits = 0;
+static unsigned int _edje_program_cache_misses = 0;
 
 
 /*============================================================================*
  *                                   API                                      *
  *============================================================================*/
 
+EAPI void
+edje_program_cache_set(int count)
+{
+   if (count < 0) count = 0;
+   _edje_program_cache_size = count;
+   _edje_cache_program_cache_trim_all();
+}
+
+EAPI int
+edje_program_cache_get(void)
+{
+   return _edje_program_cache_size;
+}
+
+EAPI void
+edje_program_cache_stats_get(unsigned int *hits, unsigned int *misses)
+{
+   if (hits) *hits = _edje_program_cache_hits;
+   if (misses) *misses = _edje_program_cache_misses;
+}
+
+EAPI void
+edje_animation_lod_set(Eina_Bool on)
+{
+   _edje_animation_lod = !!on;
+}
+
+EAPI Eina_Bool
+edje_animation_lod_get(void)
+{
+   return _edje_animation_lod;
+}
+
+EAPI void
+edje_animation_lod_small_set(Evas_Coord size, unsigned int divisor)
+{
+   if (size < 0) size = 0;
+   _edje_animation_lod_size = size;
+   _edje_animation_lod_divisor = divisor;
+}
+
+EAPI void
+edje_animation_lod_small_get(Evas_Coord *size, unsigned int *divisor)
+{
+   if (size) *size = _edje_animation_lod_size;
+   if (divisor) *divisor = _edje_animation_lod_divisor;
+}
+
 EAPI void
 edje_frametime_set(double t)
 {
@@ -173,14 +254,99 @@ edje_object_signal_emit(Evas_Object *obj, const char *emission, const char *sour
    _edje_emit(ed, (char *)emission, (char *)source);
 }
 
+EAPI void
+edje_object_signal_batch_emit(Evas_Object *obj, const Edje_Signal_Emission *signals, unsigned int count)
+{
+   Edje_Message_Signal_Set *emsg;
+   Edje *ed;
+   unsigned int i;
+
+   if ((!signals) || (!count)) return;
+   ed = _edje_fetch(obj);
+   if (!ed) return;
+   if (ed->delete_me) return;
+
+   emsg = malloc(sizeof (Edje_Message_Signal_Set) +
+                 (count - 1) * sizeof (Edje_Message_Signal));
+   if (!emsg) return;
+   emsg->count = 0;
+
+   /* the forwarded signals can run external code */
+   _edje_ref(ed);
+   for (i = 0; (i < count) && (!ed->delete_me); i++)
+     {
+        Edje_Message_Signal *sig;
+
+        if ((!signals[i].emission) || (!signals[i].source)) continue;
+        if (!_edje_emit_forward(ed, signals[i].emission, signals[i].source))
+          continue;
+
+        sig = &emsg->sig[emsg->count++];
+        sig->sig = eina_stringshare_add(signals[i].emission);
+        sig->src = eina_stringshare_add(signals[i].source);
+        sig->data = NULL;
+     }
+   if ((emsg->count) && (!ed->delete_me))
+     edje_object_message_send(ed->obj, EDJE_MESSAGE_SIGNAL_SET, 0, emsg);
+   _edje_unref(ed);
+
+   for (i = 0; i < (unsigned int)emsg->count; i++)
+     {
+        eina_stringshare_del(emsg->sig[i].sig);
+        eina_stringshare_del(emsg->sig[i].src);
+     }
+   free(emsg);
+}
+
+EAPI void
+edje_objects_signal_emit(Evas_Object * const *objs, unsigned int count, const char *emission, const char *source)
+{
+   Edje_Message_Signal emsg;
+   Edje **eds;
+   unsigned int i, n = 0;
+
+   if ((!objs) || (!emission) || (!source) || (!count)) return;
+
+   /* every object is held before the first emit, a callback deleting one
+    * of the others must not leave it dangling for the rest of the loop */
+   eds = malloc(sizeof (Edje *) * count);
+   if (!eds) return;
+   for (i = 0; i < count; i++)
+     {
+        Edje *ed;
+
+        ed = _edje_fetch(objs[i]);
+        if ((!ed) || (ed->delete_me)) continue;
+        _edje_ref(ed);
+        eds[n++] = ed;
+     }
+
+   emsg.sig = eina_stringshare_add(emission);
+   emsg.src = eina_stringshare_add(source);
+   emsg.data = NULL;
+   for (i = 0; i < n; i++)
+     {
+        Edje *ed = eds[i];
+
+        if (ed->delete_me) continue;
+        if (!_edje_emit_forward(ed, emission, source)) continue;
+        if (ed->delete_me) continue;
+        edje_object_message_send(ed->obj, EDJE_MESSAGE_SIGNAL, 0, &emsg);
+     }
+   eina_stringshare_del(emsg.sig);
+   eina_stringshare_del(emsg.src);
+
+   for (i = 0; i < n; i++)
+     _edje_unref(eds[i]);
+   free(eds);
+}
+
 /* FIXDOC: Verify/Expand */
 EAPI void
 edje_object_play_set(Evas_Object *obj, Eina_Bool play)
 {
    Edje *ed;
    double t;
-   Eina_List *l;
-   Edje_Running_Program *runp;
    unsigned int i;
 
    ed = _edje_fetch(obj);
@@ -191,8 +357,8 @@ edje_object_play_set(Evas_Object *obj, Eina_Bool play)
 	if (!ed->paused) return;
 	ed->paused = 0;
 	t = ecore_time_get() - ed->paused_at;
-	EINA_LIST_FOREACH(ed->actions, l, runp)
-	  runp->start_time += t;
+	for (i = 0; i < ed->actions_count; i++)
+	  ed->actions[i]->start_time += t;
      }
    else
      {
@@ -205,8 +371,8 @@ edje_object_play_set(Evas_Object *obj, Eina_Bool play)
      {
 	Edje_Real_Part *rp;
 	rp = ed->table_parts[i];
-	if (rp->part->type == EDJE_PART_TYPE_GROUP && rp->swallowed_object)
-	  edje_object_play_set(rp->swallowed_object, play);
+	if (rp->part->type == EDJE_PART_TYPE_GROUP && rp->typedata.swallow->swallowed_object)
+	  edje_object_play_set(rp->typedata.swallow->swallowed_object, play);
      }
 }
 
@@ -222,12 +388,33 @@ edje_object_play_get(const Evas_Object *obj)
    return EINA_TRUE;
 }
 
+EAPI void
+edje_object_animation_lod_set(Evas_Object *obj, Edje_Animation_Lod lod)
+{
+   Edje *ed;
+
+   ed = _edje_fetch(obj);
+   if (!ed) return;
+   if ((lod < EDJE_ANIMATION_LOD_DEFAULT) || (lod > EDJE_ANIMATION_LOD_ON))
+     return;
+   ed->animation_lod = lod;
+}
+
+EAPI Edje_Animation_Lod
+edje_object_animation_lod_get(const Evas_Object *obj)
+{
+   Edje *ed;
+
+   ed = _edje_fetch(obj);
+   if (!ed) return EDJE_ANIMATION_LOD_DEFAULT;
+   return ed->animation_lod;
+}
+
 /* FIXDOC: Verify/Expand */
 EAPI void
 edje_object_animation_set(Evas_Object *obj, Eina_Bool on)
 {
    Edje *ed;
-   Eina_List *l;
    unsigned int i;
 
    ed = _edje_fetch(obj);
@@ -238,24 +425,30 @@ edje_object_animation_set(Evas_Object *obj, Eina_Bool on)
    _edje_freeze(ed);
    if (!on)
      {
-	Eina_List *newl = NULL;
-	const void *data;
-
-	EINA_LIST_FOREACH(ed->actions, l, data)
-	  newl = eina_list_append(newl, data);
-	while (newl)
+	Eina_Bool walking;
+	unsigned int count;
+
+	/* finish the programs running now, the ones they start are
+	 * appended past count and ended programs are only dropped once
+	 * done walking */
+	walking = ed->walking_actions;
+	ed->walking_actions = 1;
+	count = ed->actions_count;
+	for (i = 0; (i < count) && (i < ed->actions_count); i++)
 	  {
 	     Edje_Running_Program *runp;
 
-	     runp = eina_list_data_get(newl);
-	     newl = eina_list_remove(newl, eina_list_data_get(newl));
+	     runp = ed->actions[i];
+	     if (runp->delete_me) continue;
 	     _edje_program_run_iterate(runp, runp->start_time + TO_DOUBLE(runp->program->tween.time));
 	     if (_edje_block_break(ed))
 	       {
-		  eina_list_free(newl);
+		  ed->walking_actions = walking;
 		  goto break_prog;
 	       }
 	  }
+	ed->walking_actions = walking;
+	if (!walking) _edje_running_programs_compact(ed);
      }
    else
      {
@@ -272,8 +465,8 @@ edje_object_animation_set(Evas_Object *obj, Eina_Bool on)
      {
 	Edje_Real_Part *rp;
 	rp = ed->table_parts[i];
-	if (rp->part->type == EDJE_PART_TYPE_GROUP && rp->swallowed_object)
-	  edje_object_animation_set(rp->swallowed_object, on);
+	if (rp->part->type == EDJE_PART_TYPE_GROUP && rp->typedata.swallow->swallowed_object)
+	  edje_object_animation_set(rp->typedata.swallow->swallowed_object, on);
      }
 
    _edje_thaw(ed);
@@ -295,12 +488,152 @@ edje_object_animation_get(const Evas_Object *obj)
 
 /* Private Routines */
 
+/* a tweened state change that can start right away, so the running
+ * program of the step before it can simply carry on with it */
+static Eina_Bool
+_edje_program_timeline_step(const Edje_Program *pr)
+{
+   if (pr->action != EDJE_ACTION_TYPE_STATE_SET) return EINA_FALSE;
+   if (pr->tween.time <= ZERO) return EINA_FALSE;
+   if (pr->tween.mode & EDJE_TWEEN_MODE_OPT_FROM_CURRENT) return EINA_FALSE;
+   if ((pr->in.from > 0.0) && (pr->in.range >= 0.0)) return EINA_FALSE;
+   return EINA_TRUE;
+}
+
+static Eina_Bool
+_edje_program_targets_same(const Edje_Program *a, const Edje_Program *b)
+{
+   const Eina_List *la, *lb;
+
+   for (la = a->targets, lb = b->targets; la && lb;
+        la = eina_list_next(la), lb = eina_list_next(lb))
+     {
+	const Edje_Program_Target *pa = eina_list_data_get(la);
+	const Edje_Program_Target *pb = eina_list_data_get(lb);
+
+	if (pa->id != pb->id) return EINA_FALSE;
+     }
+   return (!la) && (!lb);
+}
+
+/* find the programs whose only "after" is another step on the same
+ * targets, looping pulses and spinners then run as one timeline */
+void
+_edje_programs_timelines_init(Edje *ed)
+{
+   Edje_Program_After *pa;
+   Edje_Program *pr, *next;
+   int i;
+
+   for (i = 0; i < ed->table_programs_size; i++)
+     {
+	pr = ed->table_programs[i];
+	if (!pr) continue;
+	pr->timeline_next = 0;
+	if (!_edje_program_timeline_step(pr)) continue;
+	if (eina_list_count(pr->after) != 1) continue;
+	pa = eina_list_data_get(pr->after);
+	if ((pa->id < 0) || (pa->id >= ed->table_programs_size)) continue;
+	next = ed->table_programs[pa->id];
+	if ((!next) || (!_edje_program_timeline_step(next))) continue;
+	if (!_edje_program_targets_same(pr, next)) continue;
+	pr->timeline_next = pa->id + 1;
+     }
+}
+
+/* the step following pr on its timeline, still checked against what
+ * edje_edit may have changed since the timelines were found */
+static Edje_Program *
+_edje_program_timeline_next(Edje *ed, Edje_Program *pr)
+{
+   Edje_Program_After *pa;
+   Edje_Program *next;
+
+   if (!pr->timeline_next) return NULL;
+   if (eina_list_count(pr->after) != 1) return NULL;
+   pa = eina_list_data_get(pr->after);
+   if ((pa->id != pr->timeline_next - 1) || (pa->id >= ed->table_programs_size))
+     return NULL;
+   next = ed->table_programs[pa->id];
+   if ((!next) || (!_edje_program_timeline_step(next))) return NULL;
+   return next;
+}
+
+/* move runp on to next without ending it, skipping the steps that already
+ * ended by tim, so a loop costs no allocation nor rerun of the program.
+ * Each step is stamped with the time this walk entered it, so coming back
+ * to any of them gives the length of the loop, wherever the loop starts. */
+static void
+_edje_program_timeline_advance(Edje *ed, Edje_Running_Program *runp, Edje_Program *next, double tim)
+{
+   Eina_List *l;
+   Edje_Program_Target *pt;
+   Edje_Program *prev, *after;
+   Edje_Real_Part *rp;
+   FLOAT_T npos;
+   double start;
+   unsigned int walk;
+   Eina_Bool looped = EINA_FALSE;
+
+   walk = ++_edje_timeline_walk;
+   if (!walk) walk = ++_edje_timeline_walk;
+   prev = runp->program;
+   prev->timeline_walk = walk;
+   prev->timeline_entered = runp->start_time;
+   start = runp->start_time + TO_DOUBLE(prev->tween.time);
+   next->timeline_walk = walk;
+   next->timeline_entered = start;
+   while (tim >= start + TO_DOUBLE(next->tween.time))
+     {
+	after = _edje_program_timeline_next(ed, next);
+	if (!after) break;
+	start += TO_DOUBLE(next->tween.time);
+	prev = next;
+	next = after;
+	if ((!looped) && (next->timeline_walk == walk))
+	  {
+	     double cycle = start - next->timeline_entered;
+
+	     /* went around the loop once, skip the other full turns */
+	     start += (tim - start) - fmod(tim - start, cycle);
+	     looped = EINA_TRUE;
+	  }
+	next->timeline_walk = walk;
+	next->timeline_entered = start;
+     }
+
+   EINA_LIST_FOREACH(runp->program->targets, l, pt)
+     {
+	if (pt->id < 0) continue;
+	rp = ed->table_parts[pt->id % ed->table_parts_size];
+	if ((rp) && (rp->program == runp)) rp->program = NULL;
+     }
+   runp->program = next;
+   runp->start_time = start;
+   npos = _edje_program_tween_pos(next, FROM_DOUBLE((tim - start) / TO_DOUBLE(next->tween.time)));
+   EINA_LIST_FOREACH(next->targets, l, pt)
+     {
+	if (pt->id < 0) continue;
+	rp = ed->table_parts[pt->id % ed->table_parts_size];
+	if (!rp) continue;
+	if (rp->program) _edje_program_end(ed, rp->program);
+	_edje_part_tween_pos_set(ed, rp, ZERO);
+	_edje_part_description_apply(ed, rp,
+				     prev->state, prev->value,
+				     next->state, next->value);
+	_edje_part_tween_pos_set(ed, rp, npos);
+	rp->program = runp;
+     }
+   _edje_recalc(ed);
+}
+
 Eina_Bool
 _edje_program_run_iterate(Edje_Running_Program *runp, double tim)
 {
-   FLOAT_T t, total;
+   FLOAT_T t, total, npos;
    Eina_List *l;
    Edje *ed;
+   Edje_Program *next;
    Edje_Program_Target *pt;
    Edje_Real_Part *rp;
 
@@ -313,17 +646,25 @@ _edje_program_run_iterate(Edje_Running_Program *runp, double tim)
    total = runp->program->tween.time;
    t = DIV(t, total);
    if (t > FROM_INT(1)) t = FROM_INT(1);
+   /* map the time along the tween once for all the targets */
+   npos = _edje_program_tween_pos(runp->program, t);
    EINA_LIST_FOREACH(runp->program->targets, l, pt)
      {
 	if (pt->id >= 0)
 	  {
 	     rp = ed->table_parts[pt->id % ed->table_parts_size];
-	     if (rp) _edje_part_pos_set(ed, rp,
-					runp->program->tween.mode, t,
-                                        runp->program->tween.v1,
-                                        runp->program->tween.v2);
+	     if (rp) _edje_part_tween_pos_set(ed, rp, npos);
 	  }
      }
+   if ((t >= FROM_INT(1)) && (!ed->no_anim) &&
+       ((next = _edje_program_timeline_next(ed, runp->program))))
+     {
+	_edje_program_timeline_advance(ed, runp, next, tim);
+	_edje_thaw(ed);
+	_edje_unref(ed);
+	_edje_unblock(ed);
+	return EINA_FALSE;
+     }
    if (t >= FROM_INT(1))
      {
         Edje_Program_After *pa;
@@ -351,12 +692,7 @@ _edje_program_run_iterate(Edje_Running_Program *runp, double tim)
 	_edje_recalc(ed);
 	runp->delete_me = 1;
 	if (!ed->walking_actions)
-	  {
-	     _edje_anim_count--;
-	     ed->actions = eina_list_remove(ed->actions, runp);
-	     if (!ed->actions)
-	       _edje_animators = eina_list_remove(_edje_animators, ed);
-	  }
+	  _edje_running_program_del(ed, runp);
 //	_edje_emit(ed, "program,stop", runp->program->name);
 	if (_edje_block_break(ed))
 	  {
@@ -430,13 +766,8 @@ _edje_program_end(Edje *ed, Edje_Running_Program *runp)
 //   pname = runp->program->name;
    if (!ed->walking_actions)
      {
-	_edje_anim_count--;
-	ed->actions = eina_list_remove(ed->actions, runp);
+	_edje_running_program_del(ed, runp);
 	free_runp = 1;
-	if (!ed->actions)
-	  {
-	     _edje_animators = eina_list_remove(_edje_animators, ed);
-	  }
      }
 //   _edje_emit(ed, "program,stop", pname);
    _edje_thaw(ed);
@@ -444,6 +775,237 @@ _edje_program_end(Edje *ed, Edje_Running_Program *runp)
    if (free_runp) free(runp);
 }
 
+/* EINA_FALSE if out of memory, runp is then left to the caller and
+ * nothing was registered */
+Eina_Bool
+_edje_running_program_add(Edje *ed, Edje_Running_Program *runp)
+{
+   if (ed->actions_count == ed->actions_size)
+     {
+	Edje_Running_Program **tmp;
+	unsigned int size;
+
+	size = ed->actions_size ? ed->actions_size * 2 : 4;
+	tmp = realloc(ed->actions, size * sizeof (Edje_Running_Program *));
+	if (!tmp)
+	  {
+	     ERR("Not enough memory to run program '%s'", runp->program->name);
+	     return EINA_FALSE;
+	  }
+	ed->actions = tmp;
+	ed->actions_size = size;
+     }
+   if (!ed->actions_count)
+     {
+	if (_edje_animators_count == _edje_animators_size)
+	  {
+	     Edje **tmp;
+	     unsigned int size;
+
+	     size = _edje_animators_size ? _edje_animators_size * 2 : 16;
+	     tmp = realloc(_edje_animators, size * sizeof (Edje *));
+	     if (!tmp)
+	       {
+		  ERR("Not enough memory to animate '%s'", ed->group);
+		  return EINA_FALSE;
+	       }
+	     _edje_animators = tmp;
+	     _edje_animators_size = size;
+	  }
+	ed->animator_index = _edje_animators_count;
+	_edje_animators[_edje_animators_count++] = ed;
+     }
+   ed->actions[ed->actions_count++] = runp;
+   if (!_edje_timer)
+     _edje_timer = ecore_animator_add(_edje_timer_cb, NULL);
+   _edje_anim_count++;
+   return EINA_TRUE;
+}
+
+static void
+_edje_animator_del(Edje *ed)
+{
+   unsigned int idx = ed->animator_index;
+
+   if ((idx >= _edje_animators_count) || (_edje_animators[idx] != ed))
+     return;
+   if (_edje_animators_walking)
+     {
+	/* keep the walked slots in place, holes are squeezed out at the end */
+	_edje_animators[idx] = NULL;
+	_edje_animators_holes = EINA_TRUE;
+	return;
+     }
+   _edje_animators_count--;
+   if (idx < _edje_animators_count)
+     {
+	_edje_animators[idx] = _edje_animators[_edje_animators_count];
+	_edje_animators[idx]->animator_index = idx;
+     }
+}
+
+void
+_edje_running_program_del(Edje *ed, Edje_Running_Program *runp)
+{
+   unsigned int i;
+
+   for (i = ed->actions_count; i > 0; i--)
+     if (ed->actions[i - 1] == runp)
+       {
+	  memmove(ed->actions + i - 1, ed->actions + i,
+		  (ed->actions_count - i) * sizeof (Edje_Running_Program *));
+	  ed->actions_count--;
+	  _edje_anim_count--;
+	  if (!ed->actions_count) _edje_animator_del(ed);
+	  return;
+       }
+}
+
+void
+_edje_running_programs_end(Edje *ed, int program_id)
+{
+   Eina_Bool walking;
+   unsigned int count, i;
+
+   walking = ed->walking_actions;
+   ed->walking_actions = 1;
+   count = ed->actions_count;
+   for (i = 0; (i < count) && (i < ed->actions_count); i++)
+     {
+	Edje_Running_Program *runp = ed->actions[i];
+
+	if ((!runp->delete_me) && (program_id == runp->program->id))
+	  _edje_program_end(ed, runp);
+     }
+   ed->walking_actions = walking;
+   if (!walking) _edje_running_programs_compact(ed);
+}
+
+void
+_edje_running_programs_compact(Edje *ed)
+{
+   unsigned int i, j;
+
+   for (i = 0, j = 0; i < ed->actions_count; i++)
+     {
+	Edje_Running_Program *runp = ed->actions[i];
+
+	if (runp->delete_me)
+	  {
+	     _edje_anim_count--;
+	     free(runp);
+	  }
+	else
+	  ed->actions[j++] = runp;
+     }
+   ed->actions_count = j;
+   if (!ed->actions_count) _edje_animator_del(ed);
+}
+
+void
+_edje_running_programs_free(Edje *ed)
+{
+   unsigned int i;
+
+   for (i = 0; i < ed->actions_count; i++)
+     {
+	_edje_anim_count--;
+	free(ed->actions[i]);
+     }
+   free(ed->actions);
+   ed->actions = NULL;
+   ed->actions_count = 0;
+   ed->actions_size = 0;
+   _edje_animator_del(ed);
+}
+
+static Eina_Bool
+_edje_rect_clip(Evas_Coord *x, Evas_Coord *y, Evas_Coord *w, Evas_Coord *h,
+                Evas_Coord cx, Evas_Coord cy, Evas_Coord cw, Evas_Coord ch)
+{
+   Evas_Coord x2, y2;
+
+   x2 = *x + *w;
+   y2 = *y + *h;
+   if (cx > *x) *x = cx;
+   if (cy > *y) *y = cy;
+   if (cx + cw < x2) x2 = cx + cw;
+   if (cy + ch < y2) y2 = cy + ch;
+   *w = x2 - *x;
+   *h = y2 - *y;
+   return (*w > 0) && (*h > 0);
+}
+
+/* whether the animator should leave the programs of ed alone on this tick,
+ * they are time based so skipping ticks does not lose their place */
+Eina_Bool
+_edje_animator_skip(Edje *ed, unsigned int tick)
+{
+   Evas_Object *clip;
+   Evas_Coord x, y, w, h, cx, cy, cw, ch;
+
+   if (ed->animation_lod == EDJE_ANIMATION_LOD_OFF) return EINA_FALSE;
+   if ((ed->animation_lod == EDJE_ANIMATION_LOD_DEFAULT) &&
+       (!_edje_animation_lod))
+     return EINA_FALSE;
+
+   if (!evas_object_visible_get(ed->obj)) return EINA_TRUE;
+   x = ed->x;
+   y = ed->y;
+   w = ed->w;
+   h = ed->h;
+   for (clip = evas_object_clip_get(ed->obj); clip;
+        clip = evas_object_clip_get(clip))
+     {
+        if (!evas_object_visible_get(clip)) return EINA_TRUE;
+        evas_object_geometry_get(clip, &cx, &cy, &cw, &ch);
+        if (!_edje_rect_clip(&x, &y, &w, &h, cx, cy, cw, ch)) return EINA_TRUE;
+     }
+   evas_output_viewport_get(ed->base.evas, &cx, &cy, &cw, &ch);
+   if (!_edje_rect_clip(&x, &y, &w, &h, cx, cy, cw, ch)) return EINA_TRUE;
+
+   if ((_edje_animation_lod_divisor > 1) &&
+       (ed->w <= _edje_animation_lod_size) &&
+       (ed->h <= _edje_animation_lod_size))
+     return ((tick + ed->animator_index) % _edje_animation_lod_divisor) != 0;
+   return EINA_FALSE;
+}
+
+unsigned int
+_edje_animators_walk_begin(void)
+{
+   _edje_animators_walking = EINA_TRUE;
+   return _edje_animators_count;
+}
+
+void
+_edje_animators_walk_end(void)
+{
+   unsigned int i, j;
+
+   _edje_animators_walking = EINA_FALSE;
+   if (_edje_animators_holes)
+     {
+        for (i = 0, j = 0; i < _edje_animators_count; i++)
+          {
+             Edje *ed = _edje_animators[i];
+
+             if (!ed) continue;
+             ed->animator_index = j;
+             _edje_animators[j++] = ed;
+          }
+        _edje_animators_count = j;
+        _edje_animators_holes = EINA_FALSE;
+     }
+   /* the last animation ended, give the array back until the next one */
+   if (!_edje_animators_count)
+     {
+        free(_edje_animators);
+        _edje_animators = NULL;
+        _edje_animators_size = 0;
+     }
+}
+
 void
 _edje_program_run(Edje *ed, Edje_Program *pr, Eina_Bool force, const char *ssig, const char *ssrc)
 {
@@ -545,20 +1107,20 @@ _edje_program_run(Edje *ed, Edje_Program *pr, Eina_Bool force, const char *ssig,
 		    }
 	       }
              // _edje_emit(ed, "program,start", pr->name);
-	     if (_edje_block_break(ed))
-	       {
-		  ed->actions = eina_list_append(ed->actions, runp);
-		  goto break_prog;
-	       }
-	     if (!ed->actions)
-	       _edje_animators = eina_list_append(_edje_animators, ed);
-	     ed->actions = eina_list_append(ed->actions, runp);
 	     runp->start_time = ecore_loop_time_get();
 	     runp->edje = ed;
 	     runp->program = pr;
-	     if (!_edje_timer)
-	       _edje_timer = ecore_animator_add(_edje_timer_cb, NULL);
-	     _edje_anim_count++;
+	     if (!_edje_running_program_add(ed, runp))
+	       {
+		  EINA_LIST_FOREACH(pr->targets, l, pt)
+		    {
+		       if (pt->id < 0) continue;
+		       rp = ed->table_parts[pt->id % ed->table_parts_size];
+		       if ((rp) && (rp->program == runp)) rp->program = NULL;
+		    }
+		  free(runp);
+	       }
+	     if (_edje_block_break(ed)) goto break_prog;
 	  }
 	else
 	  {
@@ -604,19 +1166,9 @@ _edje_program_run(Edje *ed, Edje_Program *pr, Eina_Bool force, const char *ssig,
         EINA_LIST_FOREACH(pr->targets, l, pt)
 	  {
 	     Eina_List *ll;
-	     Edje_Running_Program *runp;
 	     Edje_Pending_Program *pp;
 
-             for (ll = ed->actions; ll; )
-               {
-                  runp = ll->data;
-                  ll = ll->next;
-		  if (pt->id == runp->program->id)
-		    {
-		       _edje_program_end(ed, runp);
-//		       goto done;
-		    }
-	       }
+             _edje_running_programs_end(ed, pt->id);
              for (ll = ed->pending_actions; ll; )
               {
                   pp = ll->data;
@@ -771,7 +1323,8 @@ _edje_program_run(Edje *ed, Edje_Program *pr, Eina_Bool force, const char *ssig,
 		  for (i = 0; i < ed->table_parts_size; ++i)
 		    {
 		       rp = ed->table_parts[i];
-		       if (rp && rp->swallowed_object == focused)
+		       if (rp && (rp->type == EDJE_RP_TYPE_SWALLOW) &&
+                           rp->typedata.swallow->swallowed_object == focused)
 			 {
 			    evas_object_focus_set(focused, EINA_FALSE);
 			    break;
@@ -786,8 +1339,9 @@ _edje_program_run(Edje *ed, Edje_Program *pr, Eina_Bool force, const char *ssig,
 		  if (pt->id >= 0)
 		    {
 		       rp = ed->table_parts[pt->id % ed->table_parts_size];
-		       if (rp && rp->swallowed_object)
-                          evas_object_focus_set(rp->swallowed_object, EINA_TRUE);
+		       if (rp && (rp->type == EDJE_RP_TYPE_SWALLOW) &&
+                           rp->typedata.swallow->swallowed_object)
+                          evas_object_focus_set(rp->typedata.swallow->swallowed_object, EINA_TRUE);
 		    }
 	       }
 	  }
@@ -867,62 +1421,80 @@ _edje_emit(Edje *ed, const char *sig, const char *src)
    _edje_emit_full(ed, sig, src, NULL, NULL);
 }
 
-/* data should either be NULL or a malloc allocated data */
-void
-_edje_emit_full(Edje *ed, const char *sig, const char *src, void *data, void (*free_func)(void *))
+/* Where the "part:" prefix of a forwarded signal leads, parsed once per
+ * group. The children are not part of it, they are looked up on every
+ * emission so swallowing or packing needs no invalidation. */
+#define EDJE_SIGNAL_ROUTES_MAX 128
+
+struct _Edje_Signal_Route
 {
-   Edje_Message_Signal emsg;
-   const char *sep;
+   const char *alias; /* the part path the prefix stands for */
+   Edje_Part  *part; /* the targeted part, NULL if there is none */
+   const char *idx; /* the child of a BOX, TABLE or EXTERNAL part */
+   char        prefix[1]; /* the key, the part name and index follow it */
+};
 
-   if (ed->delete_me) return;
+static unsigned int
+_edje_signal_route_key_length(const void *key)
+{
+   const char *k = key;
+   unsigned int length = 0;
 
-   sep = strchr(sig, EDJE_PART_PATH_SEPARATOR);
+   while ((k[length]) && (k[length] != EDJE_PART_PATH_SEPARATOR))
+     length++;
+   return length;
+}
 
-   /* If we are not sending the signal to a part of the child, the
-    * signal if for ourself
-    */
-   if (sep)
-     {
-        Edje_Real_Part *rp = NULL;
-        const char *newsig;
-        Edje *ed2;
-        char *part;
-        char *idx;
-        size_t length;
+static int
+_edje_signal_route_key_cmp(const void *key1, int key1_length,
+                           const void *key2, int key2_length)
+{
+   if (key1_length != key2_length) return key1_length - key2_length;
+   return memcmp(key1, key2, key1_length);
+}
+
+static int
+_edje_signal_route_key_hash(const void *key, int key_length)
+{
+   return eina_hash_superfast(key, key_length);
+}
 
-        /* the signal contains a colon, split the signal into "parts:signal" */
-        length = sep - sig + 1;
-        part = alloca(length);
-        memcpy(part, sig, length - 1);
-        part[length - 1] = '\0';
+/* sig is looked up as is, the key ends at the separator */
+static Edje_Signal_Route *
+_edje_signal_route_get(Edje_Part_Collection *edc, const char *sig)
+{
+   Edje_Signal_Route *route;
+   unsigned int length;
+   char *part;
+   char *idx;
 
-        newsig = sep + 1;
+   if (!edc->signal_routes)
+     {
+        edc->signal_routes = eina_hash_new(EINA_KEY_LENGTH(_edje_signal_route_key_length),
+                                           EINA_KEY_CMP(_edje_signal_route_key_cmp),
+                                           EINA_KEY_HASH(_edje_signal_route_key_hash),
+                                           free, 4);
+        if (!edc->signal_routes) return NULL;
+     }
+   else
+     {
+        route = eina_hash_find(edc->signal_routes, sig);
+        if (route) return route;
+        /* signals not aimed at parts can use the separator too */
+        if (eina_hash_population(edc->signal_routes) >= EDJE_SIGNAL_ROUTES_MAX)
+          eina_hash_free_buckets(edc->signal_routes);
+     }
 
-        /* lookup for alias */
-        if (ed->collection && ed->collection->alias)
-          {
-             char *alias;
-
-             alias = eina_hash_find(ed->collection->alias, part);
-             if (alias) {
-                char *aliased;
-                int alien;
-                int nslen;
-
-                alien = strlen(alias);
-                nslen = strlen(newsig);
-                length = alien + nslen + 2;
-
-                aliased = alloca(length);
-                memcpy(aliased, alias, alien);
-                aliased[alien] = EDJE_PART_PATH_SEPARATOR;
-                memcpy(aliased + alien + 1, newsig, nslen + 1);
-
-                _edje_emit(ed, aliased, src);
-                return;
-             }
-          }
+   length = _edje_signal_route_key_length(sig);
+   route = calloc(1, sizeof (Edje_Signal_Route) + 2 * length + 1);
+   if (!route) return NULL;
+   memcpy(route->prefix, sig, length);
+   part = route->prefix + length + 1;
+   memcpy(part, sig, length);
 
+   route->alias = edc->alias ? eina_hash_find(edc->alias, part) : NULL;
+   if (!route->alias)
+     {
         /* search for the index if present and remove it from the part */
         idx = strchr(part, EDJE_PART_PATH_SEPARATOR_INDEXL);
         if (idx)
@@ -932,74 +1504,149 @@ _edje_emit_full(Edje *ed, const char *sig, const char *src, void *data, void (*f
              end = strchr(idx + 1, EDJE_PART_PATH_SEPARATOR_INDEXR);
              if (end && end != idx + 1)
                {
-                  char *tmp;
-
-                  tmp = alloca(end - idx - 1);
-                  memcpy(tmp, idx + 1, end - idx - 1);
-                  tmp[end - idx - 1] = '\0';
+                  *end = '\0';
                   *idx = '\0';
-                  idx = tmp;
-               }
-             else
-               {
-                  idx = NULL;
+                  route->idx = idx + 1;
                }
           }
 
-        /* search for the right part now */
-        rp = _edje_real_part_get(ed, part);
-        if (!rp) goto end;
+        if (!edc->part_names)
+          _edje_collection_part_names_build(edc);
+        if (edc->part_names)
+          route->part = eina_hash_find(edc->part_names, part);
+     }
 
-        switch (rp->part->type)
-          {
-           case EDJE_PART_TYPE_GROUP:
-              if (!rp->swallowed_object) goto end;
-              ed2 = _edje_fetch(rp->swallowed_object);
-              if (!ed2) goto end;
+   if (!eina_hash_direct_add(edc->signal_routes, route->prefix, route))
+     {
+        free(route);
+        return NULL;
+     }
+   return route;
+}
+
+void
+_edje_collection_signal_routes_clean(Edje_Part_Collection *edc)
+{
+   if (!edc->signal_routes) return;
+
+   eina_hash_free(edc->signal_routes);
+   edc->signal_routes = NULL;
+}
 
+/* Forward a "part:signal" to the child of the part it targets. Return
+ * EINA_FALSE if the part was an alias, the signal got emitted again under
+ * the real part path and is done. */
+static Eina_Bool
+_edje_emit_forward(Edje *ed, const char *sig, const char *src)
+{
+   Edje_Signal_Route *route;
+   Edje_Real_Part *rp = NULL;
+   const char *newsig;
+   const char *sep;
+   const char *idx;
+   Edje *ed2;
+
+   sep = strchr(sig, EDJE_PART_PATH_SEPARATOR);
+   if ((!sep) || (!ed->collection)) return EINA_TRUE;
+
+   newsig = sep + 1;
+
+   /* the signal contains a colon, "part:signal", find where it goes */
+   route = _edje_signal_route_get(ed->collection, sig);
+   if (!route) return EINA_TRUE;
+
+   if (route->alias)
+     {
+        char *aliased;
+        size_t length;
+        int alien;
+        int nslen;
+
+        alien = strlen(route->alias);
+        nslen = strlen(newsig);
+        length = alien + nslen + 2;
+
+        aliased = alloca(length);
+        memcpy(aliased, route->alias, alien);
+        aliased[alien] = EDJE_PART_PATH_SEPARATOR;
+        memcpy(aliased + alien + 1, newsig, nslen + 1);
+
+        _edje_emit(ed, aliased, src);
+        return EINA_FALSE;
+     }
+
+   /* the part ids are the same for every object of the group */
+   if ((route->part) && (route->part->id >= 0) &&
+       ((unsigned int)route->part->id < ed->table_parts_size) &&
+       (ed->table_parts[route->part->id]->part == route->part))
+     rp = ed->table_parts[route->part->id];
+   if (!rp) return EINA_TRUE;
+   idx = route->idx;
+
+   switch (rp->part->type)
+     {
+      case EDJE_PART_TYPE_GROUP:
+         if (!rp->typedata.swallow->swallowed_object) return EINA_TRUE;
+         ed2 = _edje_fetch(rp->typedata.swallow->swallowed_object);
+         if (!ed2) return EINA_TRUE;
+
+         _edje_emit(ed2, newsig, src);
+         break;
+
+      case EDJE_PART_TYPE_EXTERNAL:
+         if (!rp->typedata.swallow->swallowed_object) break ;
+
+         if (!idx)
+           {
+              _edje_external_signal_emit(rp->typedata.swallow->swallowed_object, newsig, src);
+           }
+         else
+           {
+              Evas_Object *child;
+
+              child = _edje_children_get(rp, idx);
+              ed2 = _edje_fetch(child);
+              if (!ed2) return EINA_TRUE;
+              _edje_emit(ed2, newsig, src);
+           }
+         break ;
+
+      case EDJE_PART_TYPE_BOX:
+      case EDJE_PART_TYPE_TABLE:
+         if (idx)
+           {
+              Evas_Object *child;
+
+              child = _edje_children_get(rp, idx);
+              ed2 = _edje_fetch(child);
+              if (!ed2) return EINA_TRUE;
               _edje_emit(ed2, newsig, src);
-              break;
-
-           case EDJE_PART_TYPE_EXTERNAL:
-              if (!rp->swallowed_object) break ;
-
-              if (!idx)
-                {
-                   _edje_external_signal_emit(rp->swallowed_object, newsig, src);
-                }
-              else
-                {
-                   Evas_Object *child;
-
-                   child = _edje_children_get(rp, idx);
-                   ed2 = _edje_fetch(child);
-                   if (!ed2) goto end;
-                   _edje_emit(ed2, newsig, src);
-                }
-              break ;
-
-           case EDJE_PART_TYPE_BOX:
-           case EDJE_PART_TYPE_TABLE:
-              if (idx)
-                {
-                   Evas_Object *child;
-
-                   child = _edje_children_get(rp, idx);
-                   ed2 = _edje_fetch(child);
-                   if (!ed2) goto end;
-                   _edje_emit(ed2, newsig, src);
-                }
-              break ;
-
-           default:
+           }
+         break ;
+
+      default:
 //              ERR("SPANK SPANK SPANK !!!\nYou should never be here !");
-              break;
-          }
+         break;
      }
+   return EINA_TRUE;
+}
 
- end:
-   emsg.sig = sig;
-   emsg.src = src;
+/* data should either be NULL or a malloc allocated data */
+void
+_edje_emit_full(Edje *ed, const char *sig, const char *src, void *data, void (*free_func)(void *))
+{
+   Edje_Message_Signal emsg;
+
+   if (ed->delete_me) return;
+
+   /* If we are not sending the signal to a part of the child, the
+    * signal if for ourself
+    */
+   if (!_edje_emit_forward(ed, sig, src)) return;
+
+   /* shared once here, every queued message only takes a reference */
+   emsg.sig = eina_stringshare_add(sig);
+   emsg.src = eina_stringshare_add(src);
    if (data)
      {
         emsg.data = calloc(1, sizeof(*(emsg.data)));
@@ -1033,6 +1680,8 @@ _edje_emit_full(Edje *ed, const char *sig, const char *src, void *data, void (*f
           }
         free(emsg.data);
      }
+   eina_stringshare_del(emsg.sig);
+   eina_stringshare_del(emsg.src);
 }
 
 struct _Edje_Program_Data
@@ -1062,6 +1711,116 @@ static Eina_Bool _edje_glob_callback(Edje_Program *pr, void *dt)
    return EINA_FALSE;
 }
 
+static unsigned int
+_edje_program_cache_bucket(const char *sig, const char *src)
+{
+   unsigned long h;
+
+   h = ((unsigned long)sig >> 4) ^ (((unsigned long)src >> 4) * 31);
+   return (h ^ (h >> 6)) & (EDJE_PROGRAM_CACHE_BUCKETS - 1);
+}
+
+static void
+_edje_program_cache_entry_del(Edje_Part_Collection *edc, Edje_Program_Cache_Entry *pce)
+{
+   Edje_Program_Cache_Entry **prev;
+
+   prev = &edc->prog_cache.buckets[_edje_program_cache_bucket(pce->signal, pce->source)];
+   while (*prev != pce)
+     prev = &(*prev)->bucket_next;
+   *prev = pce->bucket_next;
+
+   edc->prog_cache.lru = eina_inlist_remove(edc->prog_cache.lru, EINA_INLIST_GET(pce));
+   edc->prog_cache.count--;
+   eina_stringshare_del(pce->signal);
+   eina_stringshare_del(pce->source);
+   free(pce);
+}
+
+static Edje_Program_Cache_Entry *
+_edje_program_cache_find(Edje_Part_Collection *edc, const char *sig, const char *src)
+{
+   Edje_Program_Cache_Entry *pce;
+
+   if (!edc->prog_cache.buckets) return NULL;
+   for (pce = edc->prog_cache.buckets[_edje_program_cache_bucket(sig, src)];
+        pce; pce = pce->bucket_next)
+     if ((pce->signal == sig) && (pce->source == src))
+       {
+          edc->prog_cache.lru = eina_inlist_promote(edc->prog_cache.lru, EINA_INLIST_GET(pce));
+          return pce;
+       }
+   return NULL;
+}
+
+static void
+_edje_program_cache_add(Edje_Part_Collection *edc, const char *sig, const char *src, const Eina_List *matches)
+{
+   Edje_Program_Cache_Entry *pce;
+   Edje_Program *pr;
+   const Eina_List *l;
+   unsigned int count, i;
+   unsigned int b;
+
+   if (!edc->prog_cache.buckets)
+     {
+        edc->prog_cache.buckets = calloc(EDJE_PROGRAM_CACHE_BUCKETS,
+                                         sizeof (Edje_Program_Cache_Entry *));
+        if (!edc->prog_cache.buckets) return;
+     }
+
+   /* evict the least recently emitted pairs */
+   while ((edc->prog_cache.lru) &&
+          (edc->prog_cache.count >= (unsigned int)_edje_program_cache_size))
+     _edje_program_cache_entry_del(edc,
+                                   EINA_INLIST_CONTAINER_GET(edc->prog_cache.lru->last,
+                                                             Edje_Program_Cache_Entry));
+
+   count = eina_list_count(matches);
+   pce = malloc(sizeof (Edje_Program_Cache_Entry)
+                + (count ? count - 1 : 0) * sizeof (Edje_Program *));
+   if (!pce) return;
+   pce->signal = eina_stringshare_ref(sig);
+   pce->source = eina_stringshare_ref(src);
+   pce->count = count;
+   i = 0;
+   EINA_LIST_FOREACH(matches, l, pr)
+     pce->programs[i++] = pr;
+
+   b = _edje_program_cache_bucket(sig, src);
+   pce->bucket_next = edc->prog_cache.buckets[b];
+   edc->prog_cache.buckets[b] = pce;
+   edc->prog_cache.lru = eina_inlist_prepend(edc->prog_cache.lru, EINA_INLIST_GET(pce));
+   edc->prog_cache.count++;
+}
+
+/* what a lowered edje_program_cache_set() no longer allows */
+void
+_edje_collection_program_cache_trim(Edje_Part_Collection *edc)
+{
+   while ((edc->prog_cache.lru) &&
+          (edc->prog_cache.count > (unsigned int)_edje_program_cache_size))
+     _edje_program_cache_entry_del(edc,
+                                   EINA_INLIST_CONTAINER_GET(edc->prog_cache.lru->last,
+                                                             Edje_Program_Cache_Entry));
+   if (!edc->prog_cache.lru)
+     {
+        free(edc->prog_cache.buckets);
+        edc->prog_cache.buckets = NULL;
+     }
+}
+
+void
+_edje_collection_program_cache_clean(Edje_Part_Collection *edc)
+{
+   while (edc->prog_cache.lru)
+     _edje_program_cache_entry_del(edc,
+                                   EINA_INLIST_CONTAINER_GET(edc->prog_cache.lru,
+                                                             Edje_Program_Cache_Entry));
+   free(edc->prog_cache.buckets);
+   edc->prog_cache.buckets = NULL;
+}
+
 void
 _edje_callbacks_patterns_clean(Edje *ed)
 {
@@ -1072,7 +1831,9 @@ _edje_callbacks_patterns_clean(Edje *ed)
 		      NULL);
    ed->patterns.callbacks.exact_match = NULL;
 
-   ed->patterns.callbacks.u.callbacks.globing = eina_list_free(ed->patterns.callbacks.u.callbacks.globing);
+   free(ed->patterns.callbacks.u.callbacks.globing);
+   ed->patterns.callbacks.u.callbacks.globing = NULL;
+   ed->patterns.callbacks.u.callbacks.count = 0;
 }
 
 static void
@@ -1085,10 +1846,13 @@ _edje_callbacks_patterns_init(Edje *ed)
      return;
 
    ssp->u.callbacks.globing = edje_match_callback_hash_build(ed->callbacks,
+							     &ssp->u.callbacks.count,
 							     &ssp->exact_match);
 
-   ssp->signals_patterns = edje_match_callback_signal_init(ssp->u.callbacks.globing);
-   ssp->sources_patterns = edje_match_callback_source_init(ssp->u.callbacks.globing);
+   ssp->signals_patterns = edje_match_callback_signal_dfa_new(ssp->u.callbacks.globing,
+							      ssp->u.callbacks.count);
+   ssp->sources_patterns = edje_match_callback_source_dfa_new(ssp->u.callbacks.globing,
+							      ssp->u.callbacks.count);
 }
 
 /* FIXME: what if we delete the evas object??? */
@@ -1096,7 +1860,11 @@ void
 _edje_emit_handle(Edje *ed, const char *sig, const char *src,
                   Edje_Message_Signal_Data *sdata, Eina_Bool prop)
 {
+   Eina_Bool cache;
+
    if (ed->delete_me) return;
+   /* sig and src are stringshares, the program cache keys on them */
+   cache = (_edje_program_cache_size > 0) && (sig) && (src);
    if (!sig) sig = "";
    if (!src) src = "";
 //   printf("EDJE EMIT: (%p) signal: \"%s\" source: \"%s\"\n", ed, sig, src);
@@ -1109,94 +1877,47 @@ _edje_emit_handle(Edje *ed, const char *sig, const char *src,
 
    if (ed->collection)
      {
-#ifdef EDJE_PROGRAM_CACHE
-	Edje_Part_Collection *ec;
-	char *tmps;
-	int l1, l2;
-#endif
-	int done;
-
-#ifdef EDJE_PROGRAM_CACHE
-	ec = ed->collection;
-	l1 = strlen(sig);
-	l2 = strlen(src);
-	tmps = alloca(l1 + l2 + 3); /* \0, \337, \0 */
-	strcpy(tmps, sig);
-	tmps[l1] = '\377';
-	strcpy(&(tmps[l1 + 1]), src);
-#endif
-	done = 0;
-
-#ifdef EDJE_PROGRAM_CACHE
+	struct _Edje_Program_Data  data;
+
+	data.ed = ed;
+	data.source = src;
+	data.matches = NULL;
+
+	if (ed->table_programs_size > 0)
 	  {
-	     Eina_List *matches;
-	     Eina_List *l;
+	     Edje_Part_Collection *ec = ed->collection;
+	     Edje_Program_Cache_Entry *pce = NULL;
+	     const Eina_List *match;
+	     const Eina_List *l;
 	     Edje_Program *pr;
 
-	     if (eina_hash_find(ec->prog_cache.no_matches, tmps))
+	     /* edje_edit changed the programs through another object */
+	     if (ed->patterns.programs_generation != ec->patterns.generation)
 	       {
- 		  done = 1;
+		  _edje_programs_patterns_clean(ed);
+		  _edje_programs_patterns_init(ed);
 	       }
-	     else if ((matches = eina_hash_find(ec->prog_cache.matches, tmps)))
-	       {
-                  EINA_LIST_FOREACH(matches, l, pr)
-		    {
-                       Eina_Bool exec = EINA_TRUE;
-
-                       if (pr->filter.state)
-                         {
-                            Edje_Real_Part *rp;
-
-                            rp = _edje_real_part_get(ed, pr->filter.part ? pr->filter.part : src);
-                            if (rp)
-                              {
-                                 if (rp->program)
-                                   exec = EINA_FALSE;
-                                 else
-                                   exec = (rp->chosen_description->state.name == pr->filter.state);
-                              }
-                         }
 
-                       pr->exec = exec;
-		    }
+	     if (cache)
+	       pce = _edje_program_cache_find(ec, sig, src);
+	     if (pce)
+	       {
+		  unsigned int i;
 
-                  EINA_LIST_FOREACH(matches, l, pr)
-                    if (pr->exec)
-                      {
-                         _edje_program_run(ed, pr, 0, sig, src);
-                         if (_edje_block_break(ed))
-                           {
-                              goto break_prog;
-                           }
-                      }
-
-		  done = 1;
+		  _edje_program_cache_hits++;
+		  for (i = 0; i < pce->count; i++)
+		    _edje_glob_callback(pce->programs[i], &data);
 	       }
-	  }
-#endif
-	if (!done)
-	  {
-             struct _Edje_Program_Data  data;
-
-             data.ed = ed;
-             data.source = src;
-	     data.matches = NULL;
-
-             if (ed->table_programs_size > 0)
-               {
-		  const Eina_List *match;
-		  const Eina_List *l;
-		  Edje_Program *pr;
-
-		  if (ed->patterns.programs.u.programs.globing)
-		    if (edje_match_programs_exec(ed->patterns.programs.signals_patterns,
-						 ed->patterns.programs.sources_patterns,
+	     else
+	       {
+		  if (ec->patterns.globing)
+		    if (edje_match_programs_exec(ec->patterns.signals,
+						 ec->patterns.sources,
 						 sig,
 						 src,
-						 ed->patterns.programs.u.programs.globing,
+						 ec->patterns.globing,
 						 _edje_glob_callback,
-						 &data,
-                                                 prop) == 0)
+						 &data) == 0)
 		      goto break_prog;
 
 		  match = edje_match_signal_source_hash_get(sig, src,
@@ -1204,42 +1925,27 @@ _edje_emit_handle(Edje *ed, const char *sig, const char *src,
 		  EINA_LIST_FOREACH(match, l, pr)
 		    _edje_glob_callback(pr, &data);
 
-#ifdef EDJE_PROGRAM_CACHE
-                  EINA_LIST_FOREACH(data.matches, l, pr)
-#else
-                  EINA_LIST_FREE(data.matches, pr)
-#endif
-                    {
-                       if (pr->exec)
-                         _edje_program_run(ed, pr, 0, sig, src);
-
-                       if (_edje_block_break(ed))
-                         {
-                            eina_list_free(data.matches);
-                            data.matches = NULL;
-                            goto break_prog;
-                         }
-                    }
-               }
-
-#ifdef EDJE_PROGRAM_CACHE
-	     if (tmps)
-	       {
-		  if (data.matches == NULL)
+		  if (cache)
 		    {
-		      if (!ec->prog_cache.no_matches)
-			ec->prog_cache.no_matches = eina_hash_string_superfast_new(NULL);
-		      eina_hash_add(ec->prog_cache.no_matches, tmps, ed);
+		       _edje_program_cache_misses++;
+		       _edje_program_cache_add(ec, sig, src, data.matches);
 		    }
-		  else
+	       }
+
+	     EINA_LIST_FREE(data.matches, pr)
+	       {
+		  if (pr->exec)
+		    _edje_program_run(ed, pr, 0, sig, src);
+
+		  if (_edje_block_break(ed))
 		    {
-		      if (!ec->prog_cache.matches)
-			ec->prog_cache.matches = eina_hash_string_superfast_new(NULL);
-		      eina_hash_add(ec->prog_cache.matches, tmps, data.matches);
+		       eina_list_free(data.matches);
+		       data.matches = NULL;
+		       goto break_prog;
 		    }
 	       }
-#endif
 	  }
+
 	_edje_emit_cb(ed, sig, src, sdata, prop);
 	if (_edje_block_break(ed))
 	  {
@@ -1361,7 +2067,7 @@ _edje_external_param_info_get(const Evas_Object *obj, const char *name)
 static Edje_External_Param *
 _edje_param_external_get(Edje_Real_Part *rp, const char *name, Edje_External_Param *param)
 {
-   Evas_Object *swallowed_object = rp->swallowed_object;
+   Evas_Object *swallowed_object = rp->typedata.swallow->swallowed_object;
    const Edje_External_Param_Info *info;
 
    info = _edje_external_param_info_get(swallowed_object, name);
@@ -1391,7 +2097,7 @@ _edje_param_native_get(Edje_Real_Part *rp, const char *name, Edje_External_Param
 	     if (rp->part->entry_mode > EDJE_ENTRY_EDIT_MODE_NONE)
 	       param->s = _edje_entry_text_get(rp);
 	     else if (rp->part->type == EDJE_PART_TYPE_TEXT)
-		    param->s = rp->text.text;
+		    param->s = rp->typedata.text->text;
 	     else
 	       param->s = evas_object_textblock_text_markup_get(rp->object);
 	     return param;
@@ -1412,7 +2118,7 @@ _edje_param_native_get(Edje_Real_Part *rp, const char *name, Edje_External_Param
 		       param->s = unescaped;
 		    }
 		  else if (rp->part->type == EDJE_PART_TYPE_TEXT)
-		    param->s = rp->text.text;
+		    param->s = rp->typedata.text->text;
 		  else
 		    {
 		       const char *tmp;
@@ -1591,9 +2297,7 @@ _edje_param_native_set(Edje_Real_Part *rp, const char *name, const Edje_External
 		  if (rp->part->dragable.x < 0) d = 1.0 - d;
 		  if (rp->drag->val.x == FROM_DOUBLE(d)) return EINA_TRUE;
 		  rp->drag->val.x = FROM_DOUBLE(d);
-#ifdef EDJE_CALC_CACHE
 		  rp->invalidate = 1;
-#endif
 		  _edje_dragable_pos_set
 		    (rp->edje, rp, rp->drag->val.x, rp->drag->val.y);
 		  _edje_emit(rp->edje, "drag,set", rp->part->name);
@@ -1610,9 +2314,7 @@ _edje_param_native_set(Edje_Real_Part *rp, const char *name, const Edje_External
 		  if (rp->part->dragable.y < 0) d = 1.0 - d;
 		  if (rp->drag->val.y == FROM_DOUBLE(d)) return EINA_TRUE;
 		  rp->drag->val.y = FROM_DOUBLE(d);
-#ifdef EDJE_CALC_CACHE
 		  rp->invalidate = 1;
-#endif
 		  _edje_dragable_pos_set
 		    (rp->edje, rp, rp->drag->val.x, rp->drag->val.y);
 		  _edje_emit(rp->edje, "drag,set", rp->part->name);
@@ -1626,9 +2328,7 @@ _edje_param_native_set(Edje_Real_Part *rp, const char *name, const Edje_External
 		  rp->drag->size.x = FROM_DOUBLE(CLAMP(param->d, 0.0, 1.0));
                   rp->edje->recalc_call = 1;
 		  rp->edje->dirty = 1;
-#ifdef EDJE_CALC_CACHE
 		  rp->invalidate = 1;
-#endif
 		  _edje_recalc(rp->edje);
 		  return EINA_TRUE;
 	       }
@@ -1639,9 +2339,7 @@ _edje_param_native_set(Edje_Real_Part *rp, const char *name, const Edje_External
 		  rp->drag->size.y = FROM_DOUBLE(CLAMP(param->d, 0.0, 1.0));
                   rp->edje->recalc_call = 1;
 		  rp->edje->dirty = 1;
-#ifdef EDJE_CALC_CACHE
 		  rp->invalidate = 1;
-#endif
 		  _edje_recalc(rp->edje);
 		  return EINA_TRUE;
 	       }
@@ -1651,9 +2349,7 @@ _edje_param_native_set(Edje_Real_Part *rp, const char *name, const Edje_External
 		  if (param->type != EDJE_EXTERNAL_PARAM_TYPE_DOUBLE)
 		    return EINA_FALSE;
 		  rp->drag->step.x = FROM_DOUBLE(CLAMP(param->d, 0.0, 1.0));
-#ifdef EDJE_CALC_CACHE
 		  rp->invalidate = 1;
-#endif
 		  return EINA_TRUE;
 	       }
 	     if (!strcmp(sub_name, "step_y"))
@@ -1661,9 +2357,7 @@ _edje_param_native_set(Edje_Real_Part *rp, const char *name, const Edje_External
 		  if (param->type != EDJE_EXTERNAL_PARAM_TYPE_DOUBLE)
 		    return EINA_FALSE;
 		  rp->drag->step.y = FROM_DOUBLE(CLAMP(param->d, 0.0, 1.0));
-#ifdef EDJE_CALC_CACHE
 		  rp->invalidate = 1;
-#endif
 		  return EINA_TRUE;
 	       }
 
@@ -1672,9 +2366,7 @@ _edje_param_native_set(Edje_Real_Part *rp, const char *name, const Edje_External
 		  if (param->type != EDJE_EXTERNAL_PARAM_TYPE_DOUBLE)
 		    return EINA_FALSE;
 		  rp->drag->page.x = FROM_DOUBLE(CLAMP(param->d, 0.0, 1.0));
-#ifdef EDJE_CALC_CACHE
 		  rp->invalidate = 1;
-#endif
 		  return EINA_TRUE;
 	       }
 	     if (!strcmp(sub_name, "page_y"))
@@ -1682,9 +2374,7 @@ _edje_param_native_set(Edje_Real_Part *rp, const char *name, const Edje_External
 		  if (param->type != EDJE_EXTERNAL_PARAM_TYPE_DOUBLE)
 		    return EINA_FALSE;
 		  rp->drag->page.y = FROM_DOUBLE(CLAMP(param->d, 0.0, 1.0));
-#ifdef EDJE_CALC_CACHE
 		  rp->invalidate = 1;
-#endif
 		  return EINA_TRUE;
 	       }
 
@@ -1960,7 +2650,7 @@ _edje_param_copy(Edje_Real_Part *src_part, const char *src_param, Edje_Real_Part
 
    if (dst_part->part->type == EDJE_PART_TYPE_EXTERNAL)
      dst_info = _edje_external_param_info_get
-       (dst_part->swallowed_object, dst_param);
+       (dst_part->typedata.swallow->swallowed_object, dst_param);
    else
      dst_info = _edje_native_param_info_get(dst_part, dst_param);
 
@@ -2042,7 +2732,7 @@ _edje_param_set(Edje_Real_Part *part, const char *param, const char *value)
      return;
 
    if (part->part->type == EDJE_PART_TYPE_EXTERNAL)
-     info = _edje_external_param_info_get(part->swallowed_object, param);
+     info = _edje_external_param_info_get(part->typedata.swallow->swallowed_object, param);
    else
      info = _edje_native_param_info_get(part, param);
 
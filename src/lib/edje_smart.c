@@ -111,6 +111,10 @@ _edje_smart_add(Evas_Object *obj)
    evas_object_pass_events_set(ed->base.clipper, 1);
    ed->is_rtl = EINA_FALSE;
    ed->have_objects = 1;
+#ifdef EDJE_CALC_CACHE
+   ed->calc_cache = 1;
+#endif
+   ed->size_min_cache = 1;
    ed->references = 1;
    ed->user_defined = NULL;
 
@@ -192,16 +196,23 @@ _edje_smart_move(Evas_Object * obj, Evas_Coord x, Evas_Coord y)
           {
              Edje_Real_Part *ep;
              Evas_Coord ox, oy;
+             Evas_Coord tx = 0, ty = 0;
 
              ep = ed->table_parts[i];
+             if (ep->type == EDJE_RP_TYPE_TEXT)
+               {
+                  tx = ep->typedata.text->offset.x;
+                  ty = ep->typedata.text->offset.y;
+               }
              evas_object_geometry_get(ep->object, &ox, &oy, NULL, NULL);
-             evas_object_move(ep->object, ed->x + ep->x + ep->text.offset.x, ed->y + ep->y + ep->text.offset.y);
+             evas_object_move(ep->object, ed->x + ep->x + tx, ed->y + ep->y + ty);
              if (ep->part->entry_mode > EDJE_ENTRY_EDIT_MODE_NONE)
                _edje_entry_real_part_configure(ep);
-             if (ep->swallowed_object)
+             if ((ep->type == EDJE_RP_TYPE_SWALLOW) &&
+                 ep->typedata.swallow->swallowed_object)
                {
-                  evas_object_geometry_get(ep->swallowed_object, &ox, &oy, NULL, NULL);
-                  evas_object_move(ep->swallowed_object, ed->x + ep->x + ep->text.offset.x, ed->y + ep->y + ep->text.offset.y);
+                  evas_object_geometry_get(ep->typedata.swallow->swallowed_object, &ox, &oy, NULL, NULL);
+                  evas_object_move(ep->typedata.swallow->swallowed_object, ed->x + ep->x + tx, ed->y + ep->y + ty);
                }
           }
      }
@@ -257,9 +268,7 @@ _edje_smart_resize(Evas_Object * obj, Evas_Coord w, Evas_Coord h)
      }
    ed->w = w;
    ed->h = h;
-#ifdef EDJE_CALC_CACHE
    ed->all_part_change = 1;
-#endif
    if (_edje_script_only(ed))
      {
         _edje_script_only_resize(ed);
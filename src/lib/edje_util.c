@@ -22,6 +22,7 @@ static Eina_Rbtree *_edje_box_layout_registry = NULL;
 
 char *_edje_fontset_append = NULL;
 FLOAT_T _edje_scale = ZERO;
+unsigned int _edje_font_generation = 0;
 Eina_Bool _edje_password_show_last = EINA_FALSE;
 FLOAT_T _edje_password_show_last_timeout = ZERO;
 int _edje_freeze_val = 0;
@@ -94,16 +95,13 @@ _edje_user_definition_free(Edje_User_Defined *eud)
 	if (rp)
 	  {
 	    _edje_real_part_swallow_clear(rp);
-	    rp->swallowed_object = NULL;
-	    rp->swallow_params.min.w = 0;
-	    rp->swallow_params.min.h = 0;
-	    rp->swallow_params.max.w = 0;
-	    rp->swallow_params.max.h = 0;
-	    rp->edje->dirty = 1;
+	    rp->typedata.swallow->swallowed_object = NULL;
+	    rp->typedata.swallow->swallow_params.min.w = 0;
+	    rp->typedata.swallow->swallow_params.min.h = 0;
+	    rp->typedata.swallow->swallow_params.max.w = 0;
+	    rp->typedata.swallow->swallow_params.max.h = 0;
+	    _edje_part_dirty_set(rp->edje, rp);
 	    rp->edje->recalc_call = 1;
-#ifdef EDJE_CALC_CACHE
-	    rp->invalidate = 1;
-#endif
 	    _edje_recalc_do(rp->edje);
 	  }
 	break;
@@ -253,11 +251,11 @@ _edje_thaw_edje(Edje *ed)
 	Edje_Real_Part *rp;
 
 	rp = ed->table_parts[i];
-	if (rp->part->type == EDJE_PART_TYPE_GROUP && rp->swallowed_object)
+	if (rp->part->type == EDJE_PART_TYPE_GROUP && rp->typedata.swallow->swallowed_object)
 	  {
 	     Edje *ed2;
 
-	     ed2 = _edje_fetch(rp->swallowed_object);
+	     ed2 = _edje_fetch(rp->typedata.swallow->swallowed_object);
 	     if (ed2) _edje_thaw_edje(ed2);
 	  }
      }
@@ -299,6 +297,7 @@ edje_fontset_append_set(const char *fonts)
    if (_edje_fontset_append)
      free(_edje_fontset_append);
    _edje_fontset_append = fonts ? strdup(fonts) : NULL;
+   _edje_font_generation++;
 }
 
 EAPI const char *
@@ -438,8 +437,8 @@ edje_object_freeze(Evas_Object *obj)
      {
 	Edje_Real_Part *rp;
 	rp = ed->table_parts[i];
-	if (rp->part->type == EDJE_PART_TYPE_GROUP && rp->swallowed_object)
-	  edje_object_freeze(rp->swallowed_object);
+	if (rp->part->type == EDJE_PART_TYPE_GROUP && rp->typedata.swallow->swallowed_object)
+	  edje_object_freeze(rp->typedata.swallow->swallowed_object);
      }
    return _edje_freeze(ed);
 }
@@ -457,8 +456,8 @@ edje_object_thaw(Evas_Object *obj)
 	Edje_Real_Part *rp;
 
 	rp = ed->table_parts[i];
-	if (rp->part->type == EDJE_PART_TYPE_GROUP && rp->swallowed_object)
-	  edje_object_thaw(rp->swallowed_object);
+	if (rp->part->type == EDJE_PART_TYPE_GROUP && rp->typedata.swallow->swallowed_object)
+	  edje_object_thaw(rp->typedata.swallow->swallowed_object);
      }
    return _edje_thaw(ed);
 }
@@ -523,9 +522,7 @@ edje_color_class_set(const char *color_class, int r, int g, int b, int a, int r2
 	ed = eina_list_data_get(members);
 	ed->dirty = 1;
         ed->recalc_call = 1;
-#ifdef EDJE_CALC_CACHE
 	ed->all_part_change = 1;
-#endif
 	_edje_recalc(ed);
 	_edje_emit(ed, "color_class,set", color_class);
 	members = eina_list_next(members);
@@ -590,9 +587,7 @@ edje_color_class_del(const char *color_class)
 	ed = eina_list_data_get(members);
 	ed->dirty = 1;
         ed->recalc_call = 1;
-#ifdef EDJE_CALC_CACHE
 	ed->all_part_change = 1;
-#endif
 	_edje_recalc(ed);
 	_edje_emit(ed, "color_class,del", color_class);
 	members = eina_list_next(members);
@@ -670,9 +665,7 @@ edje_object_color_class_set(Evas_Object *obj, const char *color_class, int r, in
 	     cc->a3 = a3;
 	     ed->dirty = 1;
              ed->recalc_call = 1;
-#ifdef EDJE_CALC_CACHE
 	     ed->all_part_change = 1;
-#endif
 	     _edje_recalc(ed);
 	     return EINA_TRUE;
 	  }
@@ -699,17 +692,15 @@ edje_object_color_class_set(Evas_Object *obj, const char *color_class, int r, in
    ed->color_classes = eina_list_append(ed->color_classes, cc);
    ed->dirty = 1;
    ed->recalc_call = 1;
-#ifdef EDJE_CALC_CACHE
    ed->all_part_change = 1;
-#endif
 
    for (i = 0; i < ed->table_parts_size; i++)
      {
 	Edje_Real_Part *rp;
 
 	rp = ed->table_parts[i];
-	if (rp->part->type == EDJE_PART_TYPE_GROUP && rp->swallowed_object)
-	  edje_object_color_class_set(rp->swallowed_object, color_class,
+	if (rp->part->type == EDJE_PART_TYPE_GROUP && rp->typedata.swallow->swallowed_object)
+	  edje_object_color_class_set(rp->typedata.swallow->swallowed_object, color_class,
                                       r, g, b, a, r2, g2, b2, a2, r3, g3, b3,
                                       a3);
      }
@@ -777,15 +768,13 @@ edje_object_color_class_del(Evas_Object *obj, const char *color_class)
 	Edje_Real_Part *rp;
 
 	rp = ed->table_parts[i];
-	if (rp->part->type == EDJE_PART_TYPE_GROUP && rp->swallowed_object)
-	  edje_object_color_class_del(rp->swallowed_object, color_class);
+	if (rp->part->type == EDJE_PART_TYPE_GROUP && rp->typedata.swallow->swallowed_object)
+	  edje_object_color_class_del(rp->typedata.swallow->swallowed_object, color_class);
      }
 
    ed->dirty = 1;
    ed->recalc_call = 1;
-#ifdef EDJE_CALC_CACHE
    ed->all_part_change = 1;
-#endif
    _edje_recalc(ed);
    _edje_emit(ed, "color_class,del", color_class);
 }
@@ -829,6 +818,7 @@ edje_text_class_set(const char *text_class, const char *font, Evas_Font_Size siz
         eina_stringshare_replace(&tc->font, font);
         tc->size = size;
      }
+   _edje_font_generation++;
 
    /* Tell all members of the text class to recalc */
    members = eina_hash_find(_edje_text_class_member_hash, text_class);
@@ -840,9 +830,7 @@ edje_text_class_set(const char *text_class, const char *font, Evas_Font_Size siz
 	ed->dirty = 1;
         ed->recalc_call = 1;
 	_edje_textblock_style_all_update(ed);
-#ifdef EDJE_CALC_CACHE
 	ed->text_part_change = 1;
-#endif
 	_edje_recalc(ed);
 	members = eina_list_next(members);
      }
@@ -864,6 +852,7 @@ edje_text_class_del(const char *text_class)
    eina_stringshare_del(tc->name);
    eina_stringshare_del(tc->font);
    free(tc);
+   _edje_font_generation++;
 
    members = eina_hash_find(_edje_text_class_member_hash, text_class);
    while (members)
@@ -873,9 +862,7 @@ edje_text_class_del(const char *text_class)
 	ed = eina_list_data_get(members);
 	ed->dirty = 1;
 	_edje_textblock_style_all_update(ed);
-#ifdef EDJE_CALC_CACHE
 	ed->text_part_change = 1;
-#endif
 	_edje_recalc(ed);
 	members = eina_list_next(members);
      }
@@ -951,8 +938,8 @@ edje_object_text_class_set(Evas_Object *obj, const char *text_class, const char
 	Edje_Real_Part *rp;
 
 	rp = ed->table_parts[i];
-	if (rp->part->type == EDJE_PART_TYPE_GROUP && rp->swallowed_object)
-	  edje_object_text_class_set(rp->swallowed_object, text_class,
+	if (rp->part->type == EDJE_PART_TYPE_GROUP && rp->typedata.swallow->swallowed_object)
+	  edje_object_text_class_set(rp->typedata.swallow->swallowed_object, text_class,
                                      font, size);
      }
 
@@ -960,9 +947,7 @@ edje_object_text_class_set(Evas_Object *obj, const char *text_class, const char
    ed->text_classes = eina_list_append(ed->text_classes, tc);
    ed->dirty = 1;
    ed->recalc_call = 1;
-#ifdef EDJE_CALC_CACHE
    ed->text_part_change = 1;
-#endif
    _edje_textblock_style_all_update(ed);
    _edje_recalc(ed);
    return EINA_TRUE;
@@ -1061,34 +1046,31 @@ edje_object_text_change_cb_set(Evas_Object *obj, Edje_Text_Change_Cb func, void
 	Edje_Real_Part *rp;
 
 	rp = ed->table_parts[i];
-	if ((rp->part->type == EDJE_PART_TYPE_GROUP) && (rp->swallowed_object))
-           edje_object_text_change_cb_set(rp->swallowed_object, func, data);
+	if ((rp->part->type == EDJE_PART_TYPE_GROUP) && (rp->typedata.swallow->swallowed_object))
+           edje_object_text_change_cb_set(rp->typedata.swallow->swallowed_object, func, data);
      }
 }
 
 Eina_Bool
 _edje_object_part_text_raw_set(Evas_Object *obj, Edje_Real_Part *rp, const char *part, const char *text)
 {
-   if ((!rp->text.text) && (!text))
+   if ((!rp->typedata.text->text) && (!text))
      return EINA_FALSE;
-   if ((rp->text.text) && (text) &&
-       (!strcmp(rp->text.text, text)))
+   if ((rp->typedata.text->text) && (text) &&
+       (!strcmp(rp->typedata.text->text, text)))
      return EINA_FALSE;
-   if (rp->text.text)
+   if (rp->typedata.text->text)
      {
-	eina_stringshare_del(rp->text.text);
-	rp->text.text = NULL;
+	eina_stringshare_del(rp->typedata.text->text);
+	rp->typedata.text->text = NULL;
      }
    if (rp->part->entry_mode > EDJE_ENTRY_EDIT_MODE_NONE)
      _edje_entry_text_markup_set(rp, text);
    else
-     if (text) rp->text.text = eina_stringshare_add(text);
-   rp->edje->dirty = 1;
+     if (text) rp->typedata.text->text = eina_stringshare_add(text);
+   _edje_part_dirty_set(rp->edje, rp);
    rp->edje->recalc_call = 1;
    rp->edje->recalc_hints = 1;
-#ifdef EDJE_CALC_CACHE
-   rp->invalidate = 1;
-#endif
    _edje_recalc(rp->edje);
    if (rp->edje->text_change.func)
      rp->edje->text_change.func(rp->edje->text_change.data, obj, part);
@@ -1102,28 +1084,25 @@ _edje_object_part_text_raw_append(Evas_Object *obj, Edje_Real_Part *rp, const ch
      _edje_entry_text_markup_append(rp, text);
    else if (text)
      {
-        if (rp->text.text)
+        if (rp->typedata.text->text)
           {
              char *new = NULL;
              int len_added = strlen(text);
-             int len_old = strlen(rp->text.text);
+             int len_old = strlen(rp->typedata.text->text);
              new = malloc(len_old + len_added + 1);
-             memcpy(new, rp->text.text, len_old);
+             memcpy(new, rp->typedata.text->text, len_old);
              memcpy(new + len_old, text, len_added);
              new[len_old + len_added] = '\0';
-             eina_stringshare_replace(&rp->text.text, new);
+             eina_stringshare_replace(&rp->typedata.text->text, new);
              free(new);
           }
         else
           {
-             eina_stringshare_replace(&rp->text.text, text);
+             eina_stringshare_replace(&rp->typedata.text->text, text);
           }
      }
-   rp->edje->dirty = 1;
+   _edje_part_dirty_set(rp->edje, rp);
    rp->edje->recalc_call = 1;
-#ifdef EDJE_CALC_CACHE
-   rp->invalidate = 1;
-#endif
    _edje_recalc(rp->edje);
    if (rp->edje->text_change.func)
      rp->edje->text_change.func(rp->edje->text_change.data, obj, part);
@@ -1227,7 +1206,7 @@ edje_object_part_text_set(Evas_Object *obj, const char *part, const char *text)
    if ((rp->part->type != EDJE_PART_TYPE_TEXT) &&
        (rp->part->type != EDJE_PART_TYPE_TEXTBLOCK)) return EINA_FALSE;
    r = _edje_object_part_text_raw_set(obj, rp, part, text);
-   _edje_user_define_string(ed, part, rp->text.text);
+   _edje_user_define_string(ed, part, rp->typedata.text->text);
    return r;
 }
 
@@ -1260,7 +1239,7 @@ edje_object_part_text_get(const Evas_Object *obj, const char *part)
      return _edje_entry_text_get(rp);
    else
      {
-	if (rp->part->type == EDJE_PART_TYPE_TEXT) return rp->text.text;
+	if (rp->part->type == EDJE_PART_TYPE_TEXT) return rp->typedata.text->text;
 	if (rp->part->type == EDJE_PART_TYPE_TEXTBLOCK)
 	  return evas_object_textblock_text_markup_get(rp->object);
      }
@@ -1330,13 +1309,13 @@ edje_object_part_text_escaped_set(Evas_Object *obj, const char *part, const char
           }
         ret = _edje_object_part_text_raw_set
           (obj, rp, part, eina_strbuf_string_get(sbuf));
-        _edje_user_define_string(ed, part, rp->text.text);
+        _edje_user_define_string(ed, part, rp->typedata.text->text);
         eina_strbuf_free(sbuf);
         return ret;
      }
    if (rp->part->type != EDJE_PART_TYPE_TEXTBLOCK) return EINA_FALSE;
    ret = _edje_object_part_text_raw_set(obj, rp, part, text);
-   _edje_user_define_string(ed, part, rp->text.text);
+   _edje_user_define_string(ed, part, rp->typedata.text->text);
    return ret;
 }
 
@@ -1469,7 +1448,8 @@ edje_object_part_text_unescaped_set(Evas_Object *obj, const char *part, const ch
 	ret = _edje_object_part_text_raw_set(obj, rp, part, text);
 	free(text);
      }
-   _edje_user_define_string(ed, part, rp->text.text);
+   if (rp->type == EDJE_RP_TYPE_TEXT)
+     _edje_user_define_string(ed, part, rp->typedata.text->text);
    return ret;
 }
 
@@ -1494,7 +1474,7 @@ edje_object_part_text_unescaped_get(const Evas_Object *obj, const char *part)
      }
    else
      {
-	if (rp->part->type == EDJE_PART_TYPE_TEXT) return strdup(rp->text.text);
+	if (rp->part->type == EDJE_PART_TYPE_TEXT) return strdup(rp->typedata.text->text);
 	if (rp->part->type == EDJE_PART_TYPE_TEXTBLOCK)
 	  {
 	     const char *t = evas_object_textblock_text_markup_get(rp->object);
@@ -1560,12 +1540,9 @@ edje_object_part_text_insert(Evas_Object *obj, const char *part, const char *tex
    if ((rp->part->type != EDJE_PART_TYPE_TEXTBLOCK)) return;
    if (rp->part->entry_mode <= EDJE_ENTRY_EDIT_MODE_NONE) return;
    _edje_entry_text_markup_insert(rp, text);
-   rp->edje->dirty = 1;
+   _edje_part_dirty_set(rp->edje, rp);
    rp->edje->recalc_call = 1;
    rp->edje->recalc_hints = 1;
-#ifdef EDJE_CALC_CACHE
-   rp->invalidate = 1;
-#endif
    _edje_recalc(rp->edje);
    if (rp->edje->text_change.func)
      rp->edje->text_change.func(rp->edje->text_change.data, obj, part);
@@ -1583,12 +1560,9 @@ edje_object_part_text_append(Evas_Object *obj, const char *part, const char *tex
    if (!rp) return;
    if ((rp->part->type != EDJE_PART_TYPE_TEXTBLOCK)) return;
    _edje_object_part_text_raw_append(obj, rp, part, text);
-   rp->edje->dirty = 1;
+   _edje_part_dirty_set(rp->edje, rp);
    rp->edje->recalc_call = 1;
    rp->edje->recalc_hints = 1;
-#ifdef EDJE_CALC_CACHE
-   rp->invalidate = 1;
-#endif
    _edje_recalc(rp->edje);
    if (rp->edje->text_change.func)
      rp->edje->text_change.func(rp->edje->text_change.data, obj, part);
@@ -2551,7 +2525,7 @@ edje_object_part_swallow(Evas_Object *obj, const char *part, Evas_Object *obj_sw
      }
    _edje_real_part_swallow(rp, obj_swallow, EINA_TRUE);
 
-   if (rp->swallowed_object)
+   if (rp->typedata.swallow->swallowed_object)
      {
         if (!eud)
           {
@@ -2592,8 +2566,8 @@ edje_extern_object_min_size_set(Evas_Object *obj, Evas_Coord minw, Evas_Coord mi
    rp = evas_object_data_get(obj, "\377 edje.swallowing_part");
    if (rp)
      {
-	rp->swallow_params.min.w = minw;
-	rp->swallow_params.min.h = minh;
+	rp->typedata.swallow->swallow_params.min.w = minw;
+	rp->typedata.swallow->swallow_params.min.h = minh;
 
 	_recalc_extern_parent(obj);
      }
@@ -2608,8 +2582,8 @@ edje_extern_object_max_size_set(Evas_Object *obj, Evas_Coord maxw, Evas_Coord ma
    rp = evas_object_data_get(obj, "\377 edje.swallowing_part");
    if (rp)
      {
-	rp->swallow_params.max.w = maxw;
-	rp->swallow_params.max.h = maxh;
+	rp->typedata.swallow->swallow_params.max.w = maxw;
+	rp->typedata.swallow->swallow_params.max.h = maxh;
 
 	_recalc_extern_parent(obj);
      }
@@ -2637,9 +2611,9 @@ edje_extern_object_aspect_set(Evas_Object *obj, Edje_Aspect_Control aspect, Evas
    rp = evas_object_data_get(obj, "\377 edje.swallowing_part");
    if (rp)
      {
-	rp->swallow_params.aspect.mode = aspect;
-	rp->swallow_params.aspect.w = aw;
-	rp->swallow_params.aspect.h = ah;
+	rp->typedata.swallow->swallow_params.aspect.mode = aspect;
+	rp->typedata.swallow->swallow_params.aspect.w = aw;
+	rp->typedata.swallow->swallow_params.aspect.h = ah;
         _recalc_extern_parent(obj);
      }
 }
@@ -2848,7 +2822,7 @@ edje_object_part_unswallow(Evas_Object *obj, Evas_Object *obj_swallow)
 	return;
      }
 
-   if (rp->swallowed_object == obj_swallow)
+   if (rp->typedata.swallow->swallowed_object == obj_swallow)
      {
         Edje_User_Defined *eud;
         Eina_List *l;
@@ -2875,16 +2849,13 @@ edje_object_part_unswallow(Evas_Object *obj, Evas_Object *obj_swallow)
           }
 
         _edje_real_part_swallow_clear(rp);
-	rp->swallowed_object = NULL;
-	rp->swallow_params.min.w = 0;
-	rp->swallow_params.min.h = 0;
-	rp->swallow_params.max.w = 0;
-	rp->swallow_params.max.h = 0;
-	rp->edje->dirty = 1;
+	rp->typedata.swallow->swallowed_object = NULL;
+	rp->typedata.swallow->swallow_params.min.w = 0;
+	rp->typedata.swallow->swallow_params.min.h = 0;
+	rp->typedata.swallow->swallow_params.max.w = 0;
+	rp->typedata.swallow->swallow_params.max.h = 0;
+	_edje_part_dirty_set(rp->edje, rp);
         rp->edje->recalc_call = 1;
-#ifdef EDJE_CALC_CACHE
-	rp->invalidate = 1;
-#endif
 	_edje_recalc_do(rp->edje);
 	return;
      }
@@ -2904,7 +2875,8 @@ edje_object_part_swallow_get(const Evas_Object *obj, const char *part)
 
    rp = _edje_real_part_recursive_get(ed, part);
    if (!rp) return NULL;
-   return rp->swallowed_object;
+   if (rp->type != EDJE_RP_TYPE_SWALLOW) return NULL;
+   return rp->typedata.swallow->swallowed_object;
 }
 
 EAPI void
@@ -2968,9 +2940,8 @@ edje_object_calc_force(Evas_Object *obj)
    ed = _edje_fetch(obj);
    if (!ed) return;
    ed->dirty = 1;
-#ifdef EDJE_CALC_CACHE
    ed->all_part_change = 1;
-#endif
+   if (ed->collection) _edje_collection_size_min_clean(ed->collection);
 
    pf2 = _edje_freeze_val;
    pf = ed->freeze;
@@ -3043,32 +3014,448 @@ edje_object_parts_extends_calc(Evas_Object *obj, Evas_Coord *x, Evas_Coord *y, E
    return EINA_TRUE;
 }
 
-EAPI void
-edje_object_size_min_restricted_calc(Evas_Object *obj, Evas_Coord *minw, Evas_Coord *minh, Evas_Coord restrictedw, Evas_Coord restrictedh)
+#define EDJE_SIZE_MIN_CACHE_MAX 64
+
+typedef struct _Edje_Size_Min_Key Edje_Size_Min_Key;
+typedef struct _Edje_Size_Min_Part Edje_Size_Min_Part;
+typedef struct _Edje_Size_Min_Entry Edje_Size_Min_Entry;
+
+struct _Edje_Size_Min_Key
 {
-   Edje *ed;
-   Evas_Coord pw, ph;
+   FLOAT_T      scale;
+   Evas_Coord   restrictedw, restrictedh;
+   unsigned int generation; /* _edje_font_generation */
+   unsigned int parts_count;
+   unsigned int parts_hash; /* hash of the Edje_Size_Min_Part array */
+   Eina_Bool    is_rtl;
+};
+
+/* what a part feeds into the calc, compared as a whole on a hit so a hash
+ * collision can't return the size of another configuration */
+struct _Edje_Size_Min_Part
+{
+   const void          *desc1, *desc2;
+   FLOAT_T              pos;
+   Edje_Position_Scale  drag;
+   const char          *text, *font; /* stringshares, held by the entry */
+   int                  size;
+   Edje_Size            min, max;
+   Edje_Aspect          aspect;
+};
+
+struct _Edje_Size_Min_Entry
+{
+   Edje_Size_Min_Key key;
+   Edje_Size min;
+   Edje_Size_Min_Part parts[1];
+};
+
+static unsigned int
+_edje_size_min_hash(unsigned int hash, const void *data, unsigned int len)
+{
+   const unsigned char *p = data;
+
+   /* FNV-1a, fed incrementally with every input of the calc */
+   while (len--)
+     {
+        hash ^= *p++;
+        hash *= 16777619;
+     }
+   return hash;
+}
+
+static unsigned int
+_edje_size_min_key_length(const void *key __UNUSED__)
+{
+   return sizeof (Edje_Size_Min_Key);
+}
+
+static int
+_edje_size_min_key_cmp(const void *key1, int key1_length __UNUSED__,
+                       const void *key2, int key2_length __UNUSED__)
+{
+   return memcmp(key1, key2, sizeof (Edje_Size_Min_Key));
+}
+
+static int
+_edje_size_min_key_hash(const void *key, int key_length)
+{
+   return eina_hash_superfast(key, key_length);
+}
+
+static void
+_edje_size_min_entry_free(void *data)
+{
+   Edje_Size_Min_Entry *entry = data;
+   unsigned int i;
+
+   for (i = 0; i < entry->key.parts_count; i++)
+     {
+        eina_stringshare_del(entry->parts[i].text);
+        eina_stringshare_del(entry->parts[i].font);
+     }
+   free(entry);
+}
+
+/* Build the key describing everything the min size depends on besides the
+ * collection itself, parts must hold ed->table_parts_size entries. Return
+ * EINA_FALSE if the object holds data the key can't describe (custom
+ * states, entries, box/table children...). */
+static Eina_Bool
+_edje_size_min_key_get(Edje *ed, Edje_Size_Min_Key *key, Edje_Size_Min_Part *parts, Evas_Coord restrictedw, Evas_Coord restrictedh)
+{
+   unsigned int i;
+
+   if ((!ed->size_min_cache) || (ed->text_classes)) return EINA_FALSE;
+
+   memset(parts, 0, sizeof (Edje_Size_Min_Part) * ed->table_parts_size);
+   for (i = 0; i < ed->table_parts_size; i++)
+     {
+        Edje_Size_Min_Part *p = parts + i;
+        Edje_Real_Part *rp;
+
+        rp = ed->table_parts[i];
+        if ((rp->custom) || (rp->part->entry_mode > EDJE_ENTRY_EDIT_MODE_NONE))
+          return EINA_FALSE;
+
+        p->desc1 = rp->param1.description;
+        if (rp->param2)
+          {
+             p->desc2 = rp->param2->description;
+             p->pos = rp->description_pos;
+          }
+        if (rp->drag)
+          p->drag = rp->drag->val;
+
+        switch (rp->type)
+          {
+           case EDJE_RP_TYPE_TEXT:
+              p->text = rp->typedata.text->text;
+              p->font = rp->typedata.text->font;
+              p->size = rp->typedata.text->size;
+              break;
+           case EDJE_RP_TYPE_CONTAINER:
+              if (rp->typedata.container->items) return EINA_FALSE;
+              break;
+           case EDJE_RP_TYPE_SWALLOW:
+              if (rp->typedata.swallow->swallowed_object)
+                {
+                   p->min = rp->typedata.swallow->swallow_params.min;
+                   p->max = rp->typedata.swallow->swallow_params.max;
+                   p->aspect = rp->typedata.swallow->swallow_params.aspect;
+                }
+              break;
+          }
+     }
+
+   memset(key, 0, sizeof (Edje_Size_Min_Key));
+   /* the scale the calc will use, objects without their own follow
+    * edje_scale_set() */
+   key->scale = (ed->scale != ZERO) ? ed->scale : _edje_scale;
+   key->restrictedw = restrictedw;
+   key->restrictedh = restrictedh;
+   key->generation = _edje_font_generation;
+   key->parts_count = ed->table_parts_size;
+   key->parts_hash = _edje_size_min_hash(2166136261U, parts,
+                                         sizeof (Edje_Size_Min_Part) * ed->table_parts_size);
+   key->is_rtl = ed->is_rtl;
+   return EINA_TRUE;
+}
+
+static Edje_Size_Min_Entry *
+_edje_size_min_cache_find(Edje_Part_Collection *edc, const Edje_Size_Min_Key *key, const Edje_Size_Min_Part *parts)
+{
+   Edje_Size_Min_Entry *entry;
+
+   entry = eina_hash_find(edc->size_min_cache, key);
+   if (!entry) return NULL;
+   if (memcmp(entry->parts, parts, sizeof (Edje_Size_Min_Part) * key->parts_count))
+     return NULL;
+   return entry;
+}
+
+static void
+_edje_size_min_cache_add(Edje_Part_Collection *edc, const Edje_Size_Min_Key *key, const Edje_Size_Min_Part *parts, Evas_Coord minw, Evas_Coord minh)
+{
+   Edje_Size_Min_Entry *entry;
+   unsigned int i;
+
+   if (!edc->size_min_cache)
+     {
+        edc->size_min_cache = eina_hash_new(EINA_KEY_LENGTH(_edje_size_min_key_length),
+                                            EINA_KEY_CMP(_edje_size_min_key_cmp),
+                                            EINA_KEY_HASH(_edje_size_min_key_hash),
+                                            _edje_size_min_entry_free, 5);
+        if (!edc->size_min_cache) return;
+     }
+   /* many different texts go through the same group, don't grow forever */
+   else if (eina_hash_population(edc->size_min_cache) >= EDJE_SIZE_MIN_CACHE_MAX)
+     eina_hash_free_buckets(edc->size_min_cache);
+   else
+     /* a colliding configuration under the same key is replaced */
+     eina_hash_del_by_key(edc->size_min_cache, key);
+
+   entry = malloc(sizeof (Edje_Size_Min_Entry)
+                  + sizeof (Edje_Size_Min_Part) * key->parts_count);
+   if (!entry) return;
+   entry->key = *key;
+   entry->min.w = minw;
+   entry->min.h = minh;
+   memcpy(entry->parts, parts, sizeof (Edje_Size_Min_Part) * key->parts_count);
+   for (i = 0; i < key->parts_count; i++)
+     {
+        eina_stringshare_ref(entry->parts[i].text);
+        eina_stringshare_ref(entry->parts[i].font);
+     }
+   if (!eina_hash_direct_add(edc->size_min_cache, &entry->key, entry))
+     _edje_size_min_entry_free(entry);
+}
+
+void
+_edje_collection_size_min_clean(Edje_Part_Collection *edc)
+{
+   if (!edc->size_min_cache) return;
+
+   eina_hash_free(edc->size_min_cache);
+   edc->size_min_cache = NULL;
+}
+
+typedef struct _Edje_Size_Min_Slope Edje_Size_Min_Slope;
+
+struct _Edje_Size_Min_Slope
+{
+   double x, w, y, h; /* growth of the part geometry per pixel of the object */
+   unsigned char state; /* 0 = not computed, 1 = computing, 2 = done */
+};
+
+static void _edje_size_min_slope_get(Edje *ed, Edje_Real_Part *ep, Edje_Size_Min_Slope *slopes);
+
+static void
+_edje_size_min_slope_state(Edje *ed, Edje_Real_Part_State *state, Edje_Size_Min_Slope *slopes, Edje_Size_Min_Slope *r)
+{
+   Edje_Part_Description_Common *desc = state->description;
+   Edje_Size_Min_Slope *to;
+   double x2, y2;
+
+   if (state->rel1_to_x)
+     {
+        _edje_size_min_slope_get(ed, state->rel1_to_x, slopes);
+        to = slopes + state->rel1_to_x->part->id;
+        r->x = to->x + TO_DOUBLE(desc->rel1.relative_x) * to->w;
+     }
+   else r->x = TO_DOUBLE(desc->rel1.relative_x);
+
+   if (state->rel2_to_x)
+     {
+        _edje_size_min_slope_get(ed, state->rel2_to_x, slopes);
+        to = slopes + state->rel2_to_x->part->id;
+        x2 = to->x + TO_DOUBLE(desc->rel2.relative_x) * to->w;
+     }
+   else x2 = TO_DOUBLE(desc->rel2.relative_x);
+   r->w = x2 - r->x;
+
+   if (state->rel1_to_y)
+     {
+        _edje_size_min_slope_get(ed, state->rel1_to_y, slopes);
+        to = slopes + state->rel1_to_y->part->id;
+        r->y = to->y + TO_DOUBLE(desc->rel1.relative_y) * to->h;
+     }
+   else r->y = TO_DOUBLE(desc->rel1.relative_y);
+
+   if (state->rel2_to_y)
+     {
+        _edje_size_min_slope_get(ed, state->rel2_to_y, slopes);
+        to = slopes + state->rel2_to_y->part->id;
+        y2 = to->y + TO_DOUBLE(desc->rel2.relative_y) * to->h;
+     }
+   else y2 = TO_DOUBLE(desc->rel2.relative_y);
+   r->h = y2 - r->y;
+}
+
+/* The requested geometry of a part is linear in the object size as long as
+ * the parts it is relative to are not clamped by their min/max, so its
+ * slope follows from the relative values of the chain of rel_to parts. */
+static void
+_edje_size_min_slope_get(Edje *ed, Edje_Real_Part *ep, Edje_Size_Min_Slope *slopes)
+{
+   Edje_Size_Min_Slope *r = slopes + ep->part->id;
+   Edje_Size_Min_Slope r2;
+   double pos;
+
+   if (r->state) return; /* done, or a loop that recalc will complain about */
+   r->state = 1;
+   if (!ep->param1.description)
+     {
+        r->state = 2;
+        return;
+     }
+
+   _edje_size_min_slope_state(ed, &ep->param1, slopes, r);
+   pos = TO_DOUBLE(ep->description_pos);
+   if ((ep->param2) && (ep->param2->description) && (pos != 0.0))
+     {
+        _edje_size_min_slope_state(ed, ep->param2, slopes, &r2);
+        r->x += pos * (r2.x - r->x);
+        r->w += pos * (r2.w - r->w);
+        r->y += pos * (r2.y - r->y);
+        r->h += pos * (r2.h - r->h);
+     }
+   r->state = 2;
+}
+
+/* Return the slopes of all parts, or NULL if a part has a constraint whose
+ * min size can't be derived that way (textblock, aspect) */
+static Edje_Size_Min_Slope *
+_edje_size_min_slopes_new(Edje *ed)
+{
+   Edje_Size_Min_Slope *slopes;
+   unsigned int i;
+
+   for (i = 0; i < ed->table_parts_size; i++)
+     {
+        Edje_Real_Part *ep;
+        Edje_Part_Description_Common *desc;
+
+        ep = ed->table_parts[i];
+        desc = ep->chosen_description;
+        if (!desc) continue;
+        if ((ep->part->type == EDJE_PART_TYPE_TEXTBLOCK) &&
+            ((!desc->fixed.w) || (!desc->fixed.h)))
+          return NULL;
+        if ((desc->aspect.min > ZERO) || (desc->aspect.max > ZERO))
+          return NULL;
+        if ((ep->type == EDJE_RP_TYPE_SWALLOW) &&
+            (ep->typedata.swallow->swallow_params.aspect.mode > EDJE_ASPECT_CONTROL_NONE))
+          return NULL;
+     }
+
+   slopes = calloc(ed->table_parts_size, sizeof (Edje_Size_Min_Slope));
+   if (!slopes) return NULL;
+   for (i = 0; i < ed->table_parts_size; i++)
+     _edje_size_min_slope_get(ed, ed->table_parts[i], slopes);
+   return slopes;
+}
+
+static int
+_edje_size_min_grow(int over, double slope)
+{
+   double grow;
+
+   if (slope <= 0.0) return -1;
+   grow = (double)over / slope;
+   if (grow > 4000.0) return -1;
+   return (int)ceil(grow);
+}
+
+/* Whether a part overflows the object at its current size, by the rules
+ * _edje_size_min_iterate() grows it by */
+static void
+_edje_size_min_overflow_get(Edje *ed, int *okw, int *okh)
+{
+   unsigned int i;
+
+   *okw = *okh = 0;
+   for (i = 0; i < ed->table_parts_size; i++)
+     {
+        Edje_Real_Part *ep;
+        int w, h;
+
+        ep = ed->table_parts[i];
+        if (!ep->chosen_description) continue;
+        w = ep->w - ep->req.w;
+        h = ep->h - ep->req.h;
+        if (!ep->chosen_description->fixed.w)
+          {
+             if (ep->part->type == EDJE_PART_TYPE_TEXTBLOCK)
+               {
+                  Evas_Coord tb_mw;
+
+                  evas_object_textblock_size_formatted_get(ep->object, &tb_mw, NULL);
+                  tb_mw -= ep->req.w;
+                  if (tb_mw > w) w = tb_mw;
+               }
+             if (w > 0) *okw = 1;
+          }
+        else w = 0;
+        if ((!ep->chosen_description->fixed.h) && (h > 0) &&
+            (!((ep->part->type == EDJE_PART_TYPE_TEXTBLOCK) &&
+               (!((Edje_Part_Description_Text *)ep->chosen_description)->text.min_x) &&
+               (w > 0))))
+          *okh = 1;
+     }
+}
+
+/* A growth derived from the slopes can step past the min size, as the
+ * parts round their geometry. Bisect each side back down between the
+ * biggest size seen overflowing and the one that fits, keeping only sizes
+ * a recalc confirmed. */
+static void
+_edje_size_min_bisect(Edje *ed, Evas_Coord failw, Evas_Coord failh, int *iterations)
+{
+   Evas_Coord fitw, fith, mid;
+   int okw, okh;
+
+   fitw = ed->w;
+   fith = ed->h;
+   while (fitw - failw > 1)
+     {
+        mid = failw + ((fitw - failw) / 2);
+        ed->w = mid;
+        ed->h = fith;
+        ed->dirty = 1;
+        ed->all_part_change = 1;
+        _edje_recalc_do(ed);
+        (*iterations)++;
+        _edje_size_min_overflow_get(ed, &okw, &okh);
+        if ((okw) || (okh)) failw = mid;
+        else fitw = mid;
+     }
+   while (fith - failh > 1)
+     {
+        mid = failh + ((fith - failh) / 2);
+        ed->w = fitw;
+        ed->h = mid;
+        ed->dirty = 1;
+        ed->all_part_change = 1;
+        _edje_recalc_do(ed);
+        (*iterations)++;
+        _edje_size_min_overflow_get(ed, &okw, &okh);
+        if ((okw) || (okh)) failh = mid;
+        else fith = mid;
+     }
+   ed->w = fitw;
+   ed->h = fith;
+}
+
+/* Grow the object from the restricted size until no part overflows. With
+ * solve, the growth is derived from the slopes of the overflowing parts and
+ * the next recalc only verifies it and a bisection takes back what it
+ * overshot, otherwise the object grows by the biggest overflow at each
+ * step. Leave the result in ed->w/h. */
+static void
+_edje_size_min_iterate(Edje *ed, Evas_Coord restrictedw, Evas_Coord restrictedh, Eina_Bool solve, int *iterations)
+{
+   Edje_Size_Min_Slope *slopes = NULL;
    int maxw, maxh;
+   int groww, growh;
    int okw, okh;
    int reset_maxwh;
+   Evas_Coord failw, failh;
+   Eina_Bool jumped;
    Edje_Real_Part *pep = NULL;
    Eina_Bool has_non_fixed_tb = EINA_FALSE;
 
-   ed = _edje_fetch(obj);
-   if ((!ed) || (!ed->collection))
-     {
-	if (minw) *minw = restrictedw;
-	if (minh) *minh = restrictedh;
-	return;
-     }
+   *iterations = 0;
+   if (solve) slopes = _edje_size_min_slopes_new(ed);
+
    reset_maxwh = 1;
-   ed->calc_only = 1;
-   pw = ed->w;
-   ph = ed->h;
 
    again:
    ed->w = restrictedw;
    ed->h = restrictedh;
+   failw = ed->w - 1;
+   failh = ed->h - 1;
+   jumped = EINA_FALSE;
 
    maxw = 0;
    maxh = 0;
@@ -3079,15 +3466,15 @@ edje_object_size_min_restricted_calc(Evas_Object *obj, Evas_Coord *minw, Evas_Co
 
         okw = okh = 0;
 	ed->dirty = 1;
-#ifdef EDJE_CALC_CACHE
 	ed->all_part_change = 1;
-#endif
 	_edje_recalc_do(ed);
+	(*iterations)++;
 	if (reset_maxwh)
 	  {
 	     maxw = 0;
 	     maxh = 0;
 	  }
+	groww = growh = 0;
 	pep = NULL;
 	has_non_fixed_tb = EINA_FALSE;
 	for (i = 0; i < ed->table_parts_size; i++)
@@ -3116,6 +3503,13 @@ edje_object_size_min_restricted_calc(Evas_Object *obj, Evas_Coord *minw, Evas_Co
                               }
                             has_non_fixed_tb = EINA_TRUE;
 			 }
+		       if ((slopes) && (w > 0) && (groww >= 0))
+			 {
+			    int g;
+
+			    g = _edje_size_min_grow(w, slopes[ep->part->id].w);
+			    if ((g < 0) || (g > groww)) groww = g;
+			 }
 		       if (w > maxw)
 			 {
 			    maxw = w;
@@ -3130,6 +3524,13 @@ edje_object_size_min_restricted_calc(Evas_Object *obj, Evas_Coord *minw, Evas_Co
 			     (!((Edje_Part_Description_Text *)ep->chosen_description)->text.min_x) &&
 			     (didw)))
 			 {
+			    if ((slopes) && (h > 0) && (growh >= 0))
+			      {
+				 int g;
+
+				 g = _edje_size_min_grow(h, slopes[ep->part->id].h);
+				 if ((g < 0) || (g > growh)) growh = g;
+			      }
 			    if (h > maxh)
 			      {
 				 maxh = h;
@@ -3147,12 +3548,16 @@ edje_object_size_min_restricted_calc(Evas_Object *obj, Evas_Coord *minw, Evas_Co
 	  }
 	if (okw)
 	  {
-	     ed->w += maxw;
+	     failw = ed->w;
+	     if (groww > maxw) jumped = EINA_TRUE;
+	     ed->w += (groww > maxw) ? groww : maxw;
 	     if (ed->w < restrictedw) ed->w = restrictedw;
           }
         if (okh)
           {
-	     ed->h += maxh;
+	     failh = ed->h;
+	     if (growh > maxh) jumped = EINA_TRUE;
+	     ed->h += (growh > maxh) ? growh : maxh;
 	     if (ed->h < restrictedh) ed->h = restrictedh;
 	  }
 	if ((ed->w > 4000) || (ed->h > 4000))
@@ -3173,23 +3578,85 @@ edje_object_size_min_restricted_calc(Evas_Object *obj, Evas_Coord *minw, Evas_Co
 	     if (reset_maxwh)
 	       {
 		  reset_maxwh = 0;
+		  /* the slopes lied, fall back to plain iterations */
+		  free(slopes);
+		  slopes = NULL;
 		  goto again;
 	       }
 	  }
      }
    while (okw || okh);
+
+   if (jumped) _edje_size_min_bisect(ed, failw, failh, iterations);
+   free(slopes);
+}
+
+EAPI void
+edje_object_size_min_restricted_calc(Evas_Object *obj, Evas_Coord *minw, Evas_Coord *minh, Evas_Coord restrictedw, Evas_Coord restrictedh)
+{
+   Edje *ed;
+   Evas_Coord pw, ph;
+   Edje_Size_Min_Key key;
+   Edje_Size_Min_Part *parts;
+   Eina_Bool cacheable;
+   int iterations;
+
+   ed = _edje_fetch(obj);
+   if ((!ed) || (!ed->collection))
+     {
+	if (minw) *minw = restrictedw;
+	if (minh) *minh = restrictedh;
+	return;
+     }
+
+   parts = alloca(sizeof (Edje_Size_Min_Part) * (ed->table_parts_size + 1));
+   cacheable = _edje_size_min_key_get(ed, &key, parts, restrictedw, restrictedh);
+   if ((cacheable) && (ed->collection->size_min_cache))
+     {
+        Edje_Size_Min_Entry *entry;
+
+        entry = _edje_size_min_cache_find(ed->collection, &key, parts);
+        if (entry)
+          {
+             ed->min = entry->min;
+             if (minw) *minw = ed->min.w;
+             if (minh) *minh = ed->min.h;
+             return;
+          }
+     }
+
+   ed->calc_only = 1;
+   pw = ed->w;
+   ph = ed->h;
+
+   _edje_size_min_iterate(ed, restrictedw, restrictedh, EINA_TRUE, &iterations);
    ed->min.w = ed->w;
    ed->min.h = ed->h;
 
+   if (eina_log_domain_level_check(_edje_default_log_dom, EINA_LOG_LEVEL_DBG))
+     {
+        int old_iterations;
+
+        /* run the plain iterations too, to report what the solver saved */
+        _edje_size_min_iterate(ed, restrictedw, restrictedh, EINA_FALSE, &old_iterations);
+        DBG("group %s: min size %dx%d in %d recalcs, iterative path %dx%d in %d recalcs",
+            ed->group, ed->min.w, ed->min.h, iterations,
+            ed->w, ed->h, old_iterations);
+        if ((ed->w != ed->min.w) || (ed->h != ed->min.h))
+          WRN("group %s: min size solver found %dx%d, iterative path %dx%d",
+              ed->group, ed->min.w, ed->min.h, ed->w, ed->h);
+     }
+
+   if (cacheable)
+     _edje_size_min_cache_add(ed->collection, &key, parts, ed->min.w, ed->min.h);
+
    if (minw) *minw = ed->min.w;
    if (minh) *minh = ed->min.h;
 
    ed->w = pw;
    ed->h = ph;
    ed->dirty = 1;
-#ifdef EDJE_CALC_CACHE
    ed->all_part_change = 1;
-#endif
    _edje_recalc(ed);
    ed->calc_only = 0;
 }
@@ -3301,9 +3768,7 @@ edje_object_part_drag_value_set(Evas_Object *obj, const char *part, double dx, d
    if ((rp->drag->val.x == FROM_DOUBLE(dx)) && (rp->drag->val.y == FROM_DOUBLE(dy))) return EINA_TRUE;
    rp->drag->val.x = FROM_DOUBLE(dx);
    rp->drag->val.y = FROM_DOUBLE(dy);
-#ifdef EDJE_CALC_CACHE
    rp->invalidate = 1;
-#endif
    _edje_dragable_pos_set(rp->edje, rp, rp->drag->val.x, rp->drag->val.y);
    _edje_emit(rp->edje, "drag,set", rp->part->name);
    return EINA_TRUE;
@@ -3384,9 +3849,7 @@ edje_object_part_drag_size_set(Evas_Object *obj, const char *part, double dw, do
    rp->drag->size.y = FROM_DOUBLE(dh);
    rp->edje->dirty = 1;
    rp->edje->recalc_call = 1;
-#ifdef EDJE_CALC_CACHE
    rp->invalidate = 1;
-#endif
    _edje_recalc(rp->edje);
    return EINA_TRUE;
 }
@@ -3457,9 +3920,7 @@ edje_object_part_drag_step_set(Evas_Object *obj, const char *part, double dx, do
    else if (dy > 1.0) dy = 1.0;
    rp->drag->step.x = FROM_DOUBLE(dx);
    rp->drag->step.y = FROM_DOUBLE(dy);
-#ifdef EDJE_CALC_CACHE
    rp->invalidate = 1;
-#endif
    return EINA_TRUE;
 }
 
@@ -3529,9 +3990,7 @@ edje_object_part_drag_page_set(Evas_Object *obj, const char *part, double dx, do
    else if (dy > 1.0) dy = 1.0;
    rp->drag->page.x = FROM_DOUBLE(dx);
    rp->drag->page.y = FROM_DOUBLE(dy);
-#ifdef EDJE_CALC_CACHE
    rp->invalidate = 1;
-#endif
    return EINA_TRUE;
 }
 
@@ -3606,9 +4065,7 @@ edje_object_part_drag_step(Evas_Object *obj, const char *part, double dx, double
    rp->drag->val.x = CLAMP (rp->drag->val.x, ZERO, FROM_DOUBLE(1.0));
    rp->drag->val.y = CLAMP (rp->drag->val.y, ZERO, FROM_DOUBLE(1.0));
    if ((px == rp->drag->val.x) && (py == rp->drag->val.y)) return EINA_TRUE;
-#ifdef EDJE_CALC_CACHE
    rp->invalidate = 1;
-#endif
    _edje_dragable_pos_set(rp->edje, rp, rp->drag->val.x, rp->drag->val.y);
    _edje_emit(rp->edje, "drag,step", rp->part->name);
    return EINA_TRUE;
@@ -3654,9 +4111,7 @@ edje_object_part_drag_page(Evas_Object *obj, const char *part, double dx, double
    rp->drag->val.x = CLAMP (rp->drag->val.x, ZERO, FROM_DOUBLE(1.0));
    rp->drag->val.y = CLAMP (rp->drag->val.y, ZERO, FROM_DOUBLE(1.0));
    if ((px == rp->drag->val.x) && (py == rp->drag->val.y)) return EINA_TRUE;
-#ifdef EDJE_CALC_CACHE
    rp->invalidate = 1;
-#endif
    _edje_dragable_pos_set(rp->edje, rp, rp->drag->val.x, rp->drag->val.y);
    _edje_emit(rp->edje, "drag,page", rp->part->name);
    return EINA_TRUE;
@@ -3916,9 +4371,7 @@ _edje_box_child_del_cb(void *data, Evas *e __UNUSED__, Evas_Object *child __UNUS
 
    rp->edje->dirty = 1;
    rp->edje->recalc_call = 1;
-#ifdef EDJE_CALC_CACHE
    rp->invalidate = 1;
-#endif
    _edje_recalc(rp->edje);
 }
 
@@ -3930,9 +4383,7 @@ _edje_box_child_add(Edje_Real_Part *rp, Evas_Object *child)
 
    rp->edje->dirty = 1;
    rp->edje->recalc_call = 1;
-#ifdef EDJE_CALC_CACHE
    rp->invalidate = 1;
-#endif
    _edje_recalc(rp->edje);
 }
 
@@ -3944,9 +4395,7 @@ _edje_box_child_remove(Edje_Real_Part *rp, Evas_Object *child)
 
    rp->edje->dirty = 1;
    rp->edje->recalc_call = 1;
-#ifdef EDJE_CALC_CACHE
    rp->invalidate = 1;
-#endif
    _edje_recalc(rp->edje);
 }
 
@@ -4111,9 +4560,7 @@ _edje_table_child_del_cb(void *data, Evas *e __UNUSED__, Evas_Object *child, voi
 
    rp->edje->dirty = 1;
    rp->edje->recalc_call = 1;
-#ifdef EDJE_CALC_CACHE
    rp->invalidate = 1;
-#endif
    _edje_recalc(rp->edje);
 }
 
@@ -4125,9 +4572,7 @@ _edje_table_child_add(Edje_Real_Part *rp, Evas_Object *child)
 
    rp->edje->dirty = 1;
    rp->edje->recalc_call = 1;
-#ifdef EDJE_CALC_CACHE
    rp->invalidate = 1;
-#endif
    _edje_recalc(rp->edje);
 }
 
@@ -4139,9 +4584,7 @@ _edje_table_child_remove(Edje_Real_Part *rp, Evas_Object *child)
 
    rp->edje->dirty = 1;
    rp->edje->recalc_call = 1;
-#ifdef EDJE_CALC_CACHE
    rp->invalidate = 1;
-#endif
    _edje_recalc(rp->edje);
 }
 
@@ -4456,7 +4899,7 @@ edje_object_preload(Evas_Object *obj, Eina_Bool cancel)
 	ep = rp->part;
 
 	if (ep->type == EDJE_PART_TYPE_IMAGE ||
-	    (ep->type == EDJE_PART_TYPE_GROUP && rp->swallowed_object))
+	    (ep->type == EDJE_PART_TYPE_GROUP && rp->typedata.swallow->swallowed_object))
 	  count++;
      }
 
@@ -4493,7 +4936,7 @@ edje_object_preload(Evas_Object *obj, Eina_Bool cancel)
 	       }
 	     else if (ep->type == EDJE_PART_TYPE_GROUP)
 	       {
-		  if (rp->swallowed_object) {
+		  if (rp->typedata.swallow->swallowed_object) {
                      char *tmp;
 
                      if (rp->part->name)
@@ -4503,7 +4946,7 @@ edje_object_preload(Evas_Object *obj, Eina_Bool cancel)
 
                           edje_object_signal_callback_del(obj, EDJE_PRELOAD_EMISSION, tmp, _edje_object_signal_preload_cb);
                           edje_object_signal_callback_add(obj, EDJE_PRELOAD_EMISSION, tmp, _edje_object_signal_preload_cb, ed);
-                          edje_object_preload(rp->swallowed_object, cancel);
+                          edje_object_preload(rp->typedata.swallow->swallowed_object, cancel);
                        }
                      else
                        {
@@ -4547,6 +4990,60 @@ edje_object_update_hints_get(Evas_Object *obj)
    return ed->update_hints;
 }
 
+EAPI void
+edje_object_calc_cache_set(Evas_Object *obj, Eina_Bool cache)
+{
+   Edje *ed;
+   unsigned int i;
+
+   ed = _edje_fetch(obj);
+   if (!ed) return ;
+   if (ed->calc_cache == !!cache) return ;
+
+   ed->calc_cache = !!cache;
+   if (cache) return ;
+
+   for (i = 0; i < ed->table_parts_size; i++)
+     {
+        Edje_Real_Part *rp;
+
+        rp = ed->table_parts[i];
+        _edje_calc_cache_state_clean(ed, &rp->param1);
+        _edje_calc_cache_state_clean(ed, rp->param2);
+        _edje_calc_cache_state_clean(ed, rp->custom);
+     }
+}
+
+EAPI Eina_Bool
+edje_object_calc_cache_get(const Evas_Object *obj)
+{
+   Edje *ed;
+
+   ed = _edje_fetch(obj);
+   if (!ed) return EINA_FALSE;
+
+   return ed->calc_cache;
+}
+
+EAPI void
+edje_object_calc_cache_stats_get(const Evas_Object *obj, unsigned int *hits, unsigned int *misses, unsigned int *bytes)
+{
+   Edje *ed;
+
+   ed = _edje_fetch(obj);
+   if (!ed)
+     {
+        if (hits) *hits = 0;
+        if (misses) *misses = 0;
+        if (bytes) *bytes = 0;
+        return ;
+     }
+
+   if (hits) *hits = ed->calc_cache_stats.hits;
+   if (misses) *misses = ed->calc_cache_stats.misses;
+   if (bytes) *bytes = ed->calc_cache_stats.bytes;
+}
+
 Eina_Bool
 _edje_real_part_table_pack(Edje_Real_Part *rp, Evas_Object *child_obj, unsigned short col, unsigned short row, unsigned short colspan, unsigned short rowspan)
 {
@@ -4619,7 +5116,7 @@ _edje_children_get(Edje_Real_Part *rp, const char *partid)
    switch (rp->part->type)
      {
       case EDJE_PART_TYPE_EXTERNAL:
-         return _edje_external_content_get(rp->swallowed_object, partid);
+         return _edje_external_content_get(rp->typedata.swallow->swallowed_object, partid);
       case EDJE_PART_TYPE_BOX:
          l = evas_object_box_children_get(rp->object);
          break;
@@ -4728,8 +5225,8 @@ _edje_real_part_recursive_get_helper(const Edje *ed, char **path)
    switch (rp->part->type)
      {
       case EDJE_PART_TYPE_GROUP:
-	 if (!rp->swallowed_object) return NULL;
-	 ed = _edje_fetch(rp->swallowed_object);
+	 if (!rp->typedata.swallow->swallowed_object) return NULL;
+	 ed = _edje_fetch(rp->typedata.swallow->swallowed_object);
 	 if (!ed) return NULL;
 	 path++;
 	 return _edje_real_part_recursive_get_helper(ed, path);
@@ -4751,6 +5248,39 @@ _edje_real_part_recursive_get_helper(const Edje *ed, char **path)
 }
 
 /* Private Routines */
+void
+_edje_collection_part_names_build(Edje_Part_Collection *edc)
+{
+   unsigned int i;
+
+   if (edc->part_names) return;
+
+   edc->part_names = eina_hash_string_superfast_new(NULL);
+   if (!edc->part_names) return;
+
+   for (i = 0; i < edc->parts_count; ++i)
+     {
+	Edje_Part *ep;
+
+	ep = edc->parts[i];
+	if (!ep->name) continue;
+	/* keep the first part of a given name, like the linear walk did */
+	if (eina_hash_find(edc->part_names, ep->name)) continue;
+	eina_hash_direct_add(edc->part_names, ep->name, ep);
+     }
+}
+
+void
+_edje_collection_part_names_clean(Edje_Part_Collection *edc)
+{
+   /* the signal routes point to the parts as well */
+   _edje_collection_signal_routes_clean(edc);
+   if (!edc->part_names) return;
+
+   eina_hash_free(edc->part_names);
+   edc->part_names = NULL;
+}
+
 Edje_Real_Part *
 _edje_real_part_get(const Edje *ed, const char *part)
 {
@@ -4758,6 +5288,24 @@ _edje_real_part_get(const Edje *ed, const char *part)
 
    if (!part) return NULL;
 
+   if (ed->collection)
+     {
+	Edje_Part *ep;
+
+	if (!ed->collection->part_names)
+	  _edje_collection_part_names_build(ed->collection);
+
+	if (ed->collection->part_names)
+	  {
+	     ep = eina_hash_find(ed->collection->part_names, part);
+	     if (!ep) return NULL;
+	     if ((ep->id >= 0) &&
+		 ((unsigned int) ep->id < ed->table_parts_size) &&
+		 (ed->table_parts[ep->id]->part == ep))
+	       return ed->table_parts[ep->id];
+	  }
+     }
+
    for (i = 0; i < ed->table_parts_size; i++)
      {
 	Edje_Real_Part *rp;
@@ -5009,12 +5557,12 @@ _edje_real_part_swallow_hints_update(Edje_Real_Part *rp)
 {
    const char *type;
 
-   type = evas_object_type_get(rp->swallowed_object);
+   type = evas_object_type_get(rp->typedata.swallow->swallowed_object);
 
-   rp->swallow_params.min.w = 0;
-   rp->swallow_params.min.h = 0;
-   rp->swallow_params.max.w = -1;
-   rp->swallow_params.max.h = -1;
+   rp->typedata.swallow->swallow_params.min.w = 0;
+   rp->typedata.swallow->swallow_params.min.h = 0;
+   rp->typedata.swallow->swallow_params.max.w = -1;
+   rp->typedata.swallow->swallow_params.max.h = -1;
    if ((type) && (!strcmp(type, "edje")))
      {
 	Evas_Coord w, h;
@@ -5024,62 +5572,60 @@ _edje_real_part_swallow_hints_update(Edje_Real_Part *rp)
 	rp->swallow_params.min.w = w;
 	rp->swallow_params.min.h = h;
 #endif
-	edje_object_size_max_get(rp->swallowed_object, &w, &h);
-	rp->swallow_params.max.w = w;
-	rp->swallow_params.max.h = h;
+	edje_object_size_max_get(rp->typedata.swallow->swallowed_object, &w, &h);
+	rp->typedata.swallow->swallow_params.max.w = w;
+	rp->typedata.swallow->swallow_params.max.h = h;
      }
    else if ((type) && ((!strcmp(type, "text")) || (!strcmp(type, "polygon")) ||
 		       (!strcmp(type, "line"))))
      {
 	Evas_Coord w, h;
 
-	evas_object_geometry_get(rp->swallowed_object, NULL, NULL, &w, &h);
+	evas_object_geometry_get(rp->typedata.swallow->swallowed_object, NULL, NULL, &w, &h);
 #if 0
 	rp->swallow_params.min.w = w;
 	rp->swallow_params.min.h = h;
 #endif
-	rp->swallow_params.max.w = w;
-	rp->swallow_params.max.h = h;
+	rp->typedata.swallow->swallow_params.max.w = w;
+	rp->typedata.swallow->swallow_params.max.h = h;
      }
      {
 	Evas_Coord w1, h1, w2, h2, aw, ah;
 	Evas_Aspect_Control am;
 
-	evas_object_size_hint_min_get(rp->swallowed_object, &w1, &h1);
-	evas_object_size_hint_max_get(rp->swallowed_object, &w2, &h2);
-	evas_object_size_hint_aspect_get(rp->swallowed_object, &am, &aw, &ah);
-	rp->swallow_params.min.w = w1;
-	rp->swallow_params.min.h = h1;
-	if (w2 > 0) rp->swallow_params.max.w = w2;
-	if (h2 > 0) rp->swallow_params.max.h = h2;
+	evas_object_size_hint_min_get(rp->typedata.swallow->swallowed_object, &w1, &h1);
+	evas_object_size_hint_max_get(rp->typedata.swallow->swallowed_object, &w2, &h2);
+	evas_object_size_hint_aspect_get(rp->typedata.swallow->swallowed_object, &am, &aw, &ah);
+	rp->typedata.swallow->swallow_params.min.w = w1;
+	rp->typedata.swallow->swallow_params.min.h = h1;
+	if (w2 > 0) rp->typedata.swallow->swallow_params.max.w = w2;
+	if (h2 > 0) rp->typedata.swallow->swallow_params.max.h = h2;
   	switch (am)
 	  {
 	   case EVAS_ASPECT_CONTROL_NONE:
-             rp->swallow_params.aspect.mode = EDJE_ASPECT_CONTROL_NONE;
+             rp->typedata.swallow->swallow_params.aspect.mode = EDJE_ASPECT_CONTROL_NONE;
              break;
 	   case EVAS_ASPECT_CONTROL_NEITHER:
-             rp->swallow_params.aspect.mode = EDJE_ASPECT_CONTROL_NEITHER;
+             rp->typedata.swallow->swallow_params.aspect.mode = EDJE_ASPECT_CONTROL_NEITHER;
              break;
 	   case EVAS_ASPECT_CONTROL_HORIZONTAL:
-             rp->swallow_params.aspect.mode = EDJE_ASPECT_CONTROL_HORIZONTAL;
+             rp->typedata.swallow->swallow_params.aspect.mode = EDJE_ASPECT_CONTROL_HORIZONTAL;
              break;
 	   case EVAS_ASPECT_CONTROL_VERTICAL:
-             rp->swallow_params.aspect.mode = EDJE_ASPECT_CONTROL_VERTICAL;
+             rp->typedata.swallow->swallow_params.aspect.mode = EDJE_ASPECT_CONTROL_VERTICAL;
              break;
 	   case EVAS_ASPECT_CONTROL_BOTH:
-             rp->swallow_params.aspect.mode = EDJE_ASPECT_CONTROL_BOTH;
+             rp->typedata.swallow->swallow_params.aspect.mode = EDJE_ASPECT_CONTROL_BOTH;
              break;
 	   default:
              break;
 	  }
-	rp->swallow_params.aspect.w = aw;
-	rp->swallow_params.aspect.h = ah;
-        evas_object_data_set(rp->swallowed_object, "\377 edje.swallowing_part", rp);
+	rp->typedata.swallow->swallow_params.aspect.w = aw;
+	rp->typedata.swallow->swallow_params.aspect.h = ah;
+        evas_object_data_set(rp->typedata.swallow->swallowed_object, "\377 edje.swallowing_part", rp);
      }
 
-#ifdef EDJE_CALC_CACHE
      rp->invalidate = 1;
-#endif
 }
 
 void
@@ -5089,7 +5635,7 @@ _edje_object_part_swallow_changed_hints_cb(void *data, __UNUSED__ Evas *e, __UNU
 
    rp = data;
    _edje_real_part_swallow_hints_update(rp);
-   rp->edje->dirty = 1;
+   _edje_part_dirty_set(rp->edje, rp);
    rp->edje->recalc_call = 1;
    _edje_recalc(rp->edje);
    return;
@@ -5100,38 +5646,37 @@ _edje_real_part_swallow(Edje_Real_Part *rp,
 			Evas_Object *obj_swallow,
 			Eina_Bool hints_update)
 {
-   if (rp->swallowed_object)
+   if (rp->type != EDJE_RP_TYPE_SWALLOW) return;
+   if (rp->typedata.swallow->swallowed_object)
      {
-        if (rp->swallowed_object != obj_swallow)
+        if (rp->typedata.swallow->swallowed_object != obj_swallow)
           {
-             edje_object_part_unswallow(rp->edje->obj, rp->swallowed_object);
+             edje_object_part_unswallow(rp->edje->obj, rp->typedata.swallow->swallowed_object);
           }
         else
           {
              if (hints_update)
                _edje_real_part_swallow_hints_update(rp);
-             rp->edje->dirty = 1;
+             _edje_part_dirty_set(rp->edje, rp);
              rp->edje->recalc_call = 1;
              rp->edje->recalc_hints = 1;
              _edje_recalc(rp->edje);
              return;
           }
      }
-#ifdef EDJE_CALC_CACHE
    rp->invalidate = 1;
-#endif
    if (!obj_swallow) return;
-   rp->swallowed_object = obj_swallow;
-   evas_object_smart_member_add(rp->swallowed_object, rp->edje->obj);
+   rp->typedata.swallow->swallowed_object = obj_swallow;
+   evas_object_smart_member_add(rp->typedata.swallow->swallowed_object, rp->edje->obj);
    if (rp->clip_to)
-     evas_object_clip_set(rp->swallowed_object, rp->clip_to->object);
-   else evas_object_clip_set(rp->swallowed_object, rp->edje->base.clipper);
-   evas_object_stack_above(rp->swallowed_object, rp->object);
-   evas_object_event_callback_add(rp->swallowed_object,
+     evas_object_clip_set(rp->typedata.swallow->swallowed_object, rp->clip_to->object);
+   else evas_object_clip_set(rp->typedata.swallow->swallowed_object, rp->edje->base.clipper);
+   evas_object_stack_above(rp->typedata.swallow->swallowed_object, rp->object);
+   evas_object_event_callback_add(rp->typedata.swallow->swallowed_object,
                                   EVAS_CALLBACK_DEL,
 				  _edje_object_part_swallow_free_cb,
 				  rp);
-   evas_object_event_callback_add(rp->swallowed_object,
+   evas_object_event_callback_add(rp->typedata.swallow->swallowed_object,
                                   EVAS_CALLBACK_CHANGED_SIZE_HINTS,
 				  _edje_object_part_swallow_changed_hints_cb,
 				  rp);
@@ -5150,12 +5695,12 @@ _edje_real_part_swallow(Edje_Real_Part *rp,
      }
    else
      evas_object_pass_events_set(obj_swallow, 1);
-   _edje_callbacks_focus_add(rp->swallowed_object, rp->edje, rp);
+   _edje_callbacks_focus_add(rp->typedata.swallow->swallowed_object, rp->edje, rp);
 
    if (rp->part->precise_is_inside)
      evas_object_precise_is_inside_set(obj_swallow, 1);
 
-   rp->edje->dirty = 1;
+   _edje_part_dirty_set(rp->edje, rp);
    rp->edje->recalc_call = 1;
    rp->edje->recalc_hints = 1;
    _edje_recalc(rp->edje);
@@ -5164,21 +5709,21 @@ _edje_real_part_swallow(Edje_Real_Part *rp,
 void
 _edje_real_part_swallow_clear(Edje_Real_Part *rp)
 {
-   evas_object_smart_member_del(rp->swallowed_object);
-   evas_object_event_callback_del_full(rp->swallowed_object,
+   evas_object_smart_member_del(rp->typedata.swallow->swallowed_object);
+   evas_object_event_callback_del_full(rp->typedata.swallow->swallowed_object,
                                        EVAS_CALLBACK_DEL,
                                        _edje_object_part_swallow_free_cb,
                                        rp);
-   evas_object_event_callback_del_full(rp->swallowed_object,
+   evas_object_event_callback_del_full(rp->typedata.swallow->swallowed_object,
                                        EVAS_CALLBACK_CHANGED_SIZE_HINTS,
                                        _edje_object_part_swallow_changed_hints_cb,
                                        rp);
-   evas_object_clip_unset(rp->swallowed_object);
-   evas_object_data_del(rp->swallowed_object, "\377 edje.swallowing_part");
+   evas_object_clip_unset(rp->typedata.swallow->swallowed_object);
+   evas_object_data_del(rp->typedata.swallow->swallowed_object, "\377 edje.swallowing_part");
    if (rp->part->mouse_events)
-     _edje_callbacks_del(rp->swallowed_object, rp->edje);
-   _edje_callbacks_focus_del(rp->swallowed_object, rp->edje);
-   rp->swallowed_object = NULL;
+     _edje_callbacks_del(rp->typedata.swallow->swallowed_object, rp->edje);
+   _edje_callbacks_focus_del(rp->typedata.swallow->swallowed_object, rp->edje);
+   rp->typedata.swallow->swallowed_object = NULL;
 }
 
 static void
@@ -5255,6 +5800,7 @@ _edje_program_remove(Edje_Part_Collection *edc, Edje_Program *p)
 	  (*count)--;
 	  break;
        }
+   _edje_collection_programs_patterns_clean(edc);
 }
 
 /**
@@ -5299,6 +5845,7 @@ _edje_program_insert(Edje_Part_Collection *edc, Edje_Program *p)
 
    *array = realloc(*array, sizeof (Edje_Program *) * (*count + 1));
    (*array)[(*count)++] = p;
+   _edje_collection_programs_patterns_clean(edc);
 }
 
 const char *
@@ -4,10 +4,16 @@
 
 #include <unistd.h>
 #include <stdio.h>
+#include <string.h>
 
 #include <Eina.h>
+#include <Ecore.h>
+#include <Ecore_Evas.h>
 #include <Edje.h>
 
+#define EDJE_EDIT_IS_UNSTABLE_AND_I_KNOW_ABOUT_IT 1
+#include <Edje_Edit.h>
+
 #include "edje_suite.h"
 
 START_TEST(edje_test_edje_init)
@@ -22,7 +28,541 @@ START_TEST(edje_test_edje_init)
 }
 END_TEST
 
+static const char *
+test_layout_get(void)
+{
+   return TESTS_BUILD_DIR "/edje_test.edj";
+}
+
+static void
+_edje_test_preload_cb(void *data, const char *file __UNUSED__, const char *group __UNUSED__, Eina_Bool success)
+{
+   int *loaded = data;
+
+   *loaded = success ? 1 : -1;
+   ecore_main_loop_quit();
+}
+
+START_TEST(edje_test_cache_limits)
+{
+   Ecore_Evas *ee;
+   Evas_Object *obj;
+   int i;
+
+   fail_if(!edje_init());
+   fail_if(!ecore_evas_init());
+
+   edje_collection_cache_set(1);
+   edje_collection_cache_bytes_set(1);
+   edje_file_cache_bytes_set(1);
+   fail_if(edje_collection_cache_get() != 1);
+   fail_if(edje_collection_cache_bytes_get() != 1);
+   fail_if(edje_file_cache_bytes_get() != 1);
+
+   ee = ecore_evas_buffer_new(100, 100);
+   fail_if(!ee);
+
+   /* every group is dropped from the caches as soon as it is unused,
+    * so the second pass decodes them all again */
+   for (i = 0; i < 2; i++)
+     {
+	obj = edje_object_add(ecore_evas_get(ee));
+	fail_if(!edje_object_file_set(obj, test_layout_get(), "test_nested"));
+	fail_if(!edje_object_part_object_get(obj, "sub_19"));
+	evas_object_del(obj);
+     }
+
+   edje_collection_cache_bytes_set(0);
+   edje_file_cache_bytes_set(0);
+   edje_collection_cache_set(16);
+
+   ecore_evas_free(ee);
+   ecore_evas_shutdown();
+   edje_shutdown();
+}
+END_TEST
+
+START_TEST(edje_test_collection_preload)
+{
+   Ecore_Evas *ee;
+   Evas_Object *obj;
+   int loaded = 0;
+
+   fail_if(!edje_init());
+   fail_if(!ecore_evas_init());
+
+   fail_if(edje_file_collection_preload(test_layout_get(), "no_such_group",
+					_edje_test_preload_cb, &loaded));
+   fail_if(!edje_file_collection_preload(test_layout_get(), "test_group",
+					 _edje_test_preload_cb, &loaded));
+   if (!loaded) ecore_main_loop_begin();
+   fail_if(loaded != 1);
+
+   ee = ecore_evas_buffer_new(100, 100);
+   fail_if(!ee);
+   obj = edje_object_add(ecore_evas_get(ee));
+   fail_if(!edje_object_file_set(obj, test_layout_get(), "test_group"));
+   fail_if(edje_object_load_error_get(obj) != EDJE_LOAD_ERROR_NONE);
+   fail_if(!edje_object_part_exists(obj, "background"));
+
+   evas_object_del(obj);
+   ecore_evas_free(ee);
+   ecore_evas_shutdown();
+   edje_shutdown();
+}
+END_TEST
+
+static void
+_edje_test_load_cb(void *data, Evas_Object *obj __UNUSED__, void *event_info __UNUSED__)
+{
+   int *loaded = data;
+
+   *loaded = 1;
+   ecore_main_loop_quit();
+}
+
+static void
+_edje_test_load_error_cb(void *data, Evas_Object *obj __UNUSED__, void *event_info __UNUSED__)
+{
+   int *loaded = data;
+
+   *loaded = -1;
+   ecore_main_loop_quit();
+}
+
+START_TEST(edje_test_file_set_async)
+{
+   Ecore_Evas *ee;
+   Evas_Object *obj;
+   char buf[32];
+   int loaded = 0;
+   int i;
+
+   fail_if(!edje_init());
+   fail_if(!ecore_evas_init());
+
+   /* test_nested holds more groups than the collection cache keeps */
+   fail_if(edje_collection_cache_get() >= 20);
+
+   ee = ecore_evas_buffer_new(100, 100);
+   fail_if(!ee);
+   obj = edje_object_add(ecore_evas_get(ee));
+   evas_object_smart_callback_add(obj, "load,done", _edje_test_load_cb, &loaded);
+   evas_object_smart_callback_add(obj, "load,error", _edje_test_load_error_cb, &loaded);
+
+   fail_if(!edje_object_file_set_async(obj, test_layout_get(), "test_nested"));
+   ecore_main_loop_begin();
+   fail_if(loaded != 1);
+   fail_if(edje_object_load_error_get(obj) != EDJE_LOAD_ERROR_NONE);
+   for (i = 0; i < 20; i++)
+     {
+	snprintf(buf, sizeof(buf), "sub_%i", i);
+	fail_if(!edje_object_part_object_get(obj, buf));
+     }
+
+   loaded = 0;
+   fail_if(!edje_object_file_set_async(obj, test_layout_get(), "no_such_group"));
+   ecore_main_loop_begin();
+   fail_if(loaded != -1);
+   fail_if(edje_object_load_error_get(obj) != EDJE_LOAD_ERROR_UNKNOWN_COLLECTION);
+
+   evas_object_del(obj);
+   ecore_evas_free(ee);
+   ecore_evas_shutdown();
+   edje_shutdown();
+}
+END_TEST
+
+START_TEST(edje_test_file_set_async_cancel)
+{
+   Ecore_Evas *ee;
+   Evas_Object *obj;
+
+   fail_if(!edje_init());
+   fail_if(!ecore_evas_init());
+
+   ee = ecore_evas_buffer_new(100, 100);
+   fail_if(!ee);
+   obj = edje_object_add(ecore_evas_get(ee));
+
+   /* the preloads may still be running, they are let go of by the
+    * object deletion and edje_shutdown() */
+   fail_if(!edje_object_file_set_async(obj, test_layout_get(), "test_nested"));
+   evas_object_del(obj);
+
+   ecore_evas_free(ee);
+   ecore_evas_shutdown();
+   edje_shutdown();
+}
+END_TEST
+
+START_TEST(edje_test_size_min_edit)
+{
+   Ecore_Evas *ee;
+   Evas_Object *obj, *edit;
+   Evas_Coord w, h;
+
+   fail_if(!edje_init());
+   fail_if(!ecore_evas_init());
+
+   ee = ecore_evas_buffer_new(100, 100);
+   fail_if(!ee);
+   obj = edje_object_add(ecore_evas_get(ee));
+   fail_if(!edje_object_file_set(obj, test_layout_get(), "test_size_min"));
+   edje_object_size_min_calc(obj, &w, &h);
+   fail_if((w != 20) || (h != 20));
+
+   /* the result is cached for the group, an edit must drop it */
+   edit = edje_edit_object_add(ecore_evas_get(ee));
+   fail_if(!edje_object_file_set(edit, test_layout_get(), "test_size_min"));
+   edje_edit_state_min_w_set(edit, "box", "default", 0.0, 50);
+   edje_object_size_min_calc(obj, &w, &h);
+   fail_if((w != 50) || (h != 20));
+
+   evas_object_del(edit);
+   evas_object_del(obj);
+   ecore_evas_free(ee);
+   ecore_evas_shutdown();
+   edje_shutdown();
+}
+END_TEST
+
+START_TEST(edje_test_size_min_slope)
+{
+   Ecore_Evas *ee;
+   Evas_Object *obj;
+   Evas_Coord w, h, rw, rh;
+
+   fail_if(!edje_init());
+   fail_if(!ecore_evas_init());
+
+   ee = ecore_evas_buffer_new(100, 100);
+   fail_if(!ee);
+   obj = edje_object_add(ecore_evas_get(ee));
+   fail_if(!edje_object_file_set(obj, test_layout_get(), "test_size_min_slope"));
+   edje_object_size_min_calc(obj, &w, &h);
+   fail_if((w < 57) || (h < 30));
+
+   /* starting a pixel short must grow back to the same size, a smaller
+    * result would mean the first one overshot */
+   edje_object_size_min_restricted_calc(obj, &rw, &rh, w - 1, 0);
+   fail_if((rw != w) || (rh != h));
+   edje_object_size_min_restricted_calc(obj, &rw, &rh, 0, h - 1);
+   fail_if((rw != w) || (rh != h));
+
+   evas_object_del(obj);
+   ecore_evas_free(ee);
+   ecore_evas_shutdown();
+   edje_shutdown();
+}
+END_TEST
+
+static void
+_edje_test_hit_cb(void *data, Evas_Object *obj __UNUSED__, const char *emission __UNUSED__, const char *source)
+{
+   Eina_List **hits = data;
+
+   *hits = eina_list_append(*hits, eina_stringshare_add(source));
+}
+
+/* emit and return the names of the programs that ran */
+static Eina_List *
+_edje_test_emit(Evas_Object *obj, Eina_List *hits, const char *sig, const char *src)
+{
+   const char *name;
+
+   EINA_LIST_FREE(hits, name)
+     eina_stringshare_del(name);
+   edje_object_signal_emit(obj, sig, src);
+   /* the "hit" emitted by the programs is queued again */
+   edje_message_signal_process();
+   edje_message_signal_process();
+   return hits;
+}
+
+static Eina_Bool
+_edje_test_hit(const Eina_List *hits, const char *name)
+{
+   const Eina_List *l;
+   const char *hit;
+
+   EINA_LIST_FOREACH(hits, l, hit)
+     if (!strcmp(hit, name)) return EINA_TRUE;
+   return EINA_FALSE;
+}
+
+START_TEST(edje_test_program_match)
+{
+   Ecore_Evas *ee;
+   Evas_Object *obj;
+   Eina_List *hits = NULL;
+   const char *name;
+
+   fail_if(!edje_init());
+   fail_if(!ecore_evas_init());
+
+   ee = ecore_evas_buffer_new(100, 100);
+   fail_if(!ee);
+   obj = edje_object_add(ecore_evas_get(ee));
+   fail_if(!edje_object_file_set(obj, test_layout_get(), "test_signals"));
+   edje_object_signal_callback_add(obj, "hit", "*", _edje_test_hit_cb, &hits);
+
+   hits = _edje_test_emit(obj, hits, "star", "src");
+   fail_if((eina_list_count(hits) != 1) || (!_edje_test_hit(hits, "p_star")));
+   hits = _edje_test_emit(obj, hits, "st,any,r", "src");
+   fail_if((eina_list_count(hits) != 1) || (!_edje_test_hit(hits, "p_star")));
+   hits = _edje_test_emit(obj, hits, "sta", "src");
+   fail_if(eina_list_count(hits) != 0);
+
+   hits = _edje_test_emit(obj, hits, "quest", "src");
+   fail_if((eina_list_count(hits) != 1) || (!_edje_test_hit(hits, "p_quest")));
+   hits = _edje_test_emit(obj, hits, "qu!st", "src");
+   fail_if((eina_list_count(hits) != 1) || (!_edje_test_hit(hits, "p_quest")));
+   hits = _edje_test_emit(obj, hits, "queest", "src");
+   fail_if(eina_list_count(hits) != 0);
+
+   hits = _edje_test_emit(obj, hits, "range,b", "src");
+   fail_if((eina_list_count(hits) != 1) || (!_edje_test_hit(hits, "p_range")));
+   hits = _edje_test_emit(obj, hits, "range,d", "src");
+   fail_if(eina_list_count(hits) != 0);
+
+   hits = _edje_test_emit(obj, hits, "not,y", "src");
+   fail_if((eina_list_count(hits) != 1) || (!_edje_test_hit(hits, "p_not")));
+   hits = _edje_test_emit(obj, hits, "not,x", "src");
+   fail_if(eina_list_count(hits) != 0);
+
+   /* several programs for one signal */
+   hits = _edje_test_emit(obj, hits, "multi,one", "src");
+   fail_if(eina_list_count(hits) != 3);
+   fail_if(!_edje_test_hit(hits, "p_multi1"));
+   fail_if(!_edje_test_hit(hits, "p_multi2"));
+   fail_if(!_edje_test_hit(hits, "p_multi3"));
+
+   /* the signal and the source must both match */
+   hits = _edje_test_emit(obj, hits, "and,1", "a1");
+   fail_if((eina_list_count(hits) != 1) || (!_edje_test_hit(hits, "p_and_a")));
+   hits = _edje_test_emit(obj, hits, "and,1", "b1");
+   fail_if((eina_list_count(hits) != 1) || (!_edje_test_hit(hits, "p_and_b")));
+   hits = _edje_test_emit(obj, hits, "and,1", "c1");
+   fail_if(eina_list_count(hits) != 0);
+   hits = _edje_test_emit(obj, hits, "star", "a1");
+   fail_if(eina_list_count(hits) != 0);
+
+   /* more programs than fit in one word of the match bitsets */
+   hits = _edje_test_emit(obj, hits, "many,35", "src");
+   fail_if((eina_list_count(hits) != 1) || (!_edje_test_hit(hits, "p_many_35")));
+   hits = _edje_test_emit(obj, hits, "mony,3", "src");
+   fail_if((eina_list_count(hits) != 1) || (!_edje_test_hit(hits, "p_many_3")));
+   hits = _edje_test_emit(obj, hits, "many,0", "src");
+   fail_if((eina_list_count(hits) != 1) || (!_edje_test_hit(hits, "p_many_0")));
+
+   EINA_LIST_FREE(hits, name)
+     eina_stringshare_del(name);
+   evas_object_del(obj);
+   ecore_evas_free(ee);
+   ecore_evas_shutdown();
+   edje_shutdown();
+}
+END_TEST
+
+START_TEST(edje_test_program_match_edit)
+{
+   Ecore_Evas *ee;
+   Evas_Object *obj, *obj2, *edit;
+   Eina_List *hits = NULL, *hits2 = NULL;
+   const char *name;
+
+   fail_if(!edje_init());
+   fail_if(!ecore_evas_init());
+
+   ee = ecore_evas_buffer_new(100, 100);
+   fail_if(!ee);
+   obj = edje_object_add(ecore_evas_get(ee));
+   fail_if(!edje_object_file_set(obj, test_layout_get(), "test_signals"));
+   edje_object_signal_callback_add(obj, "hit", "*", _edje_test_hit_cb, &hits);
+   obj2 = edje_object_add(ecore_evas_get(ee));
+   fail_if(!edje_object_file_set(obj2, test_layout_get(), "test_signals"));
+   edje_object_signal_callback_add(obj2, "hit", "*", _edje_test_hit_cb, &hits2);
+
+   hits = _edje_test_emit(obj, hits, "before,edit", "src");
+   fail_if((eina_list_count(hits) != 1) || (!_edje_test_hit(hits, "p_edit")));
+   hits2 = _edje_test_emit(obj2, hits2, "before,edit", "src");
+   fail_if((eina_list_count(hits2) != 1) || (!_edje_test_hit(hits2, "p_edit")));
+
+   /* the group is shared, the other objects follow the edit */
+   edit = edje_edit_object_add(ecore_evas_get(ee));
+   fail_if(!edje_object_file_set(edit, test_layout_get(), "test_signals"));
+   fail_if(!edje_edit_program_signal_set(edit, "p_edit", "after,ed?t"));
+
+   hits = _edje_test_emit(obj, hits, "before,edit", "src");
+   fail_if(eina_list_count(hits) != 0);
+   hits = _edje_test_emit(obj, hits, "after,edit", "src");
+   fail_if((eina_list_count(hits) != 1) || (!_edje_test_hit(hits, "p_edit")));
+   hits2 = _edje_test_emit(obj2, hits2, "after,edit", "src");
+   fail_if((eina_list_count(hits2) != 1) || (!_edje_test_hit(hits2, "p_edit")));
+   hits2 = _edje_test_emit(obj2, hits2, "before,edit", "src");
+   fail_if(eina_list_count(hits2) != 0);
+
+   EINA_LIST_FREE(hits, name)
+     eina_stringshare_del(name);
+   EINA_LIST_FREE(hits2, name)
+     eina_stringshare_del(name);
+   evas_object_del(edit);
+   evas_object_del(obj2);
+   evas_object_del(obj);
+   ecore_evas_free(ee);
+   ecore_evas_shutdown();
+   edje_shutdown();
+}
+END_TEST
+
+START_TEST(edje_test_program_cache_set)
+{
+   Ecore_Evas *ee;
+   Evas_Object *obj;
+   Eina_List *hits = NULL;
+   unsigned int h1, m1, h2, m2;
+   const char *name;
+
+   fail_if(!edje_init());
+   fail_if(!ecore_evas_init());
+
+   ee = ecore_evas_buffer_new(100, 100);
+   fail_if(!ee);
+   obj = edje_object_add(ecore_evas_get(ee));
+   fail_if(!edje_object_file_set(obj, test_layout_get(), "test_signals"));
+   edje_object_signal_callback_add(obj, "hit", "*", _edje_test_hit_cb, &hits);
+
+   /* each emission also looks up the "hit" its program sends */
+   hits = _edje_test_emit(obj, hits, "star", "src");
+   hits = _edje_test_emit(obj, hits, "quest", "src");
+   edje_program_cache_stats_get(&h1, &m1);
+   hits = _edje_test_emit(obj, hits, "star", "src");
+   edje_program_cache_stats_get(&h2, &m2);
+   fail_if((h2 - h1 != 2) || (m2 != m1));
+
+   /* lowering the limit drops what the group already remembers */
+   edje_program_cache_set(1);
+   edje_program_cache_stats_get(&h1, &m1);
+   hits = _edje_test_emit(obj, hits, "quest", "src");
+   edje_program_cache_stats_get(&h2, &m2);
+   fail_if((h2 != h1) || (m2 - m1 != 2));
+   fail_if((eina_list_count(hits) != 1) || (!_edje_test_hit(hits, "p_quest")));
+
+   edje_program_cache_set(0);
+   edje_program_cache_stats_get(&h1, &m1);
+   hits = _edje_test_emit(obj, hits, "star", "src");
+   edje_program_cache_stats_get(&h2, &m2);
+   fail_if((h2 != h1) || (m2 != m1));
+   fail_if((eina_list_count(hits) != 1) || (!_edje_test_hit(hits, "p_star")));
+   edje_program_cache_set(32);
+
+   EINA_LIST_FREE(hits, name)
+     eina_stringshare_del(name);
+   evas_object_del(obj);
+   ecore_evas_free(ee);
+   ecore_evas_shutdown();
+   edje_shutdown();
+}
+END_TEST
+
+static int _edje_test_cb_count[41];
+
+static void
+_edje_test_count_cb(void *data, Evas_Object *obj __UNUSED__, const char *emission __UNUSED__, const char *source __UNUSED__)
+{
+   _edje_test_cb_count[(long)data]++;
+}
+
+static int
+_edje_test_cb_emit(Evas_Object *obj, const char *sig, int idx)
+{
+   memset(_edje_test_cb_count, 0, sizeof (_edje_test_cb_count));
+   edje_object_signal_emit(obj, sig, "src");
+   edje_message_signal_process();
+   return _edje_test_cb_count[idx];
+}
+
+static int
+_edje_test_cb_total(void)
+{
+   unsigned int i;
+   int total = 0;
+
+   for (i = 0; i < sizeof (_edje_test_cb_count) / sizeof (int); i++)
+     total += _edje_test_cb_count[i];
+   return total;
+}
+
+START_TEST(edje_test_callback_match)
+{
+   Ecore_Evas *ee;
+   Evas_Object *obj;
+   char buf[256];
+   long i;
+
+   fail_if(!edje_init());
+   fail_if(!ecore_evas_init());
+
+   ee = ecore_evas_buffer_new(100, 100);
+   fail_if(!ee);
+   obj = edje_object_add(ecore_evas_get(ee));
+   fail_if(!edje_object_file_set(obj, test_layout_get(), "test_group"));
+
+   /* more callbacks than fit in one word of the match bitsets */
+   for (i = 0; i < 38; i++)
+     {
+	snprintf(buf, sizeof(buf), "cb?%li", i);
+	edje_object_signal_callback_add(obj, buf, "s*", _edje_test_count_cb, (void *)i);
+     }
+   edje_object_signal_callback_add(obj, "esc\\*", "*", _edje_test_count_cb, (void *)38L);
+
+   /* long enough for the walk to flush the automaton on the way */
+   memset(buf, 'a', 200);
+   buf[200] = '?';
+   buf[201] = 0;
+   edje_object_signal_callback_add(obj, buf, "*", _edje_test_count_cb, (void *)39L);
+
+   fail_if(_edje_test_cb_emit(obj, "cb,35", 35) != 1);
+   fail_if(_edje_test_cb_total() != 1);
+   fail_if(_edje_test_cb_emit(obj, "cb_3", 3) != 1);
+   fail_if(_edje_test_cb_total() != 1);
+   fail_if(_edje_test_cb_emit(obj, "cb,135", 35) != 0);
+   fail_if(_edje_test_cb_total() != 0);
+
+   /* an escaped star only matches itself */
+   fail_if(_edje_test_cb_emit(obj, "esc*", 38) != 1);
+   fail_if(_edje_test_cb_emit(obj, "escape", 38) != 0);
+
+   for (i = 0; i < 3; i++)
+     {
+	memset(buf, 'a', 200);
+	buf[200] = 'b';
+	buf[201] = 0;
+	fail_if(_edje_test_cb_emit(obj, buf, 39) != 1);
+	buf[199] = 'b';
+	fail_if(_edje_test_cb_emit(obj, buf, 39) != 0);
+	fail_if(_edje_test_cb_emit(obj, "cb,7", 7) != 1);
+     }
+
+   evas_object_del(obj);
+   ecore_evas_free(ee);
+   ecore_evas_shutdown();
+   edje_shutdown();
+}
+END_TEST
+
 void edje_test_edje(TCase *tc)
 {
    tcase_add_test(tc, edje_test_edje_init);
+   tcase_add_test(tc, edje_test_size_min_edit);
+   tcase_add_test(tc, edje_test_size_min_slope);
+   tcase_add_test(tc, edje_test_program_match);
+   tcase_add_test(tc, edje_test_program_match_edit);
+   tcase_add_test(tc, edje_test_callback_match);
+   tcase_add_test(tc, edje_test_program_cache_set);
+   tcase_add_test(tc, edje_test_cache_limits);
+   tcase_add_test(tc, edje_test_collection_preload);
+   tcase_add_test(tc, edje_test_file_set_async);
+   tcase_add_test(tc, edje_test_file_set_async_cancel);
 }